@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Replays the timing-regression corpus through uri_view and form_view.
+//
+// Usage: bench_corpus file...
+//
+// Each input is timed in full and truncated to half its size. Linear
+// parsing roughly doubles the time, so a larger growth factor indicates
+// super-linear behaviour and the benchmark exits with a failure.
+//
+// Slow inputs found by the fuzzers with -report_slow_units=<seconds> are
+// added to bench/corpus as regular files.
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <network/form_view.hpp>
+#include <network/uri_view.hpp>
+
+namespace
+{
+
+const double growth_limit = 3.0;
+
+std::size_t replay(const std::string& input)
+{
+    // The checksum keeps the optimizer from discarding the work
+    std::size_t checksum = 0;
+
+    network::uri_view uri(network::uri_view::string_view(input.data(), input.size()));
+    checksum += uri.host().size() + uri.path().size() + uri.query().size();
+    for (network::uri_view::segment_iterator it = uri.path_segments().begin();
+         it != uri.path_segments().end();
+         ++it)
+    {
+        checksum += it->size();
+    }
+    for (network::uri_view::query_iterator it = uri.query_params().begin();
+         it != uri.query_params().end();
+         ++it)
+    {
+        checksum += it->second.size();
+    }
+
+    network::form_view form(network::form_view::view_type(input.data(), input.size()));
+    do
+    {
+        std::string value;
+        if (form.value(value))
+            checksum += value.size();
+    } while (form.next());
+
+    return checksum;
+}
+
+// Returns nanoseconds per replay
+double measure(const std::string& input, std::size_t& checksum)
+{
+    std::size_t iterations = 1;
+    for (;;)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            checksum += replay(input);
+        }
+        const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+        if ((elapsed > std::chrono::milliseconds(50)) || (iterations >= (1U << 20)))
+            return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+        iterations *= 2;
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+    std::size_t checksum = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream file(argv[i], std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "Cannot open " << argv[i] << std::endl;
+            return 1;
+        }
+        const std::string input((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+        if (input.size() < 2)
+            continue;
+
+        const double half = measure(input.substr(0, input.size() / 2), checksum);
+        const double full = measure(input, checksum);
+        const double growth = full / half;
+
+        std::cout << argv[i]
+                  << " bytes=" << input.size()
+                  << " ns/byte=" << full / input.size()
+                  << " growth=" << growth;
+        if (growth > growth_limit)
+        {
+            std::cout << " SLOW";
+            result = 1;
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+    return result;
+}
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <network/router.hpp>
+
+namespace
+{
+
+typedef network::router<std::size_t> router_type;
+
+// Routes resemble a REST API with a mix of literals, parameters and
+// wildcards. Each route has a matching request path.
+void generate(std::size_t count,
+              std::vector<std::string>& patterns,
+              std::vector<std::string>& paths)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::ostringstream pattern;
+        std::ostringstream path;
+        pattern << "/api/v" << (i % 3) << "/resource" << i;
+        path << "/api/v" << (i % 3) << "/resource" << i;
+        switch (i % 4)
+        {
+        case 0:
+            break;
+        case 1:
+            pattern << "/:id";
+            path << "/12345";
+            break;
+        case 2:
+            pattern << "/:id/items/:item";
+            path << "/12345/items/67890";
+            break;
+        case 3:
+            pattern << "/files/*path";
+            path << "/files/alpha/bravo/charlie.txt";
+            break;
+        }
+        patterns.push_back(pattern.str());
+        paths.push_back(path.str());
+    }
+}
+
+void run(std::size_t count)
+{
+    std::vector<std::string> patterns;
+    std::vector<std::string> paths;
+    generate(count, patterns, paths);
+
+    router_type::builder builder;
+    for (std::size_t i = 0; i < patterns.size(); ++i)
+    {
+        builder.insert(patterns[i], i);
+    }
+    const router_type router(builder);
+
+    const std::size_t iterations = 1000000;
+    std::size_t matched = 0;
+    router_type::match_type match;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const std::string& path = paths[(i * 7919) % paths.size()];
+        if (router.match(path, match))
+            matched += *match.value() + match.size();
+    }
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    const double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+
+    std::cout << "routes=" << count
+              << " lookups=" << iterations
+              << " ns/lookup=" << nanoseconds / iterations
+              << " (checksum " << matched << ")"
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main()
+{
+    run(10);
+    run(1000);
+    run(10000);
+    return 0;
+}
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <network/form_view.hpp>
+#include "oracle.hpp"
+
+namespace
+{
+
+// Reference tokenizer
+//
+// form-list ::= form-key-value ( '&' form-key-value )*
+// form-key-value ::= text '=' text
+
+bool next(const std::string& input,
+          std::string::size_type& position,
+          bool first,
+          std::string& key,
+          std::string& value)
+{
+    if (position == input.size())
+        return false;
+    if (!first)
+    {
+        if (input[position] != '&')
+            return false;
+        ++position;
+    }
+    const std::string::size_type key_end = input.find_first_of("=&", position);
+    if ((key_end == position) || (key_end == std::string::npos) || (input[key_end] != '='))
+        return false;
+    const std::string::size_type value_end = std::min(input.find_first_of("=&", key_end + 1),
+                                                      input.size());
+    if (value_end == key_end + 1)
+        return false;
+
+    key = input.substr(position, key_end - position);
+    value = input.substr(key_end + 1, value_end - key_end - 1);
+    position = value_end;
+    return true;
+}
+
+} // anonymous namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size)
+{
+    const std::string input(reinterpret_cast<const char *>(data), size);
+    network::form_view form(network::form_view::view_type(input.data(), input.size()));
+
+    std::string::size_type position = 0;
+    for (bool first = true; ; first = false)
+    {
+        const bool parsed = first ? !form.literal_key().empty() : form.next();
+        std::string key;
+        std::string literal;
+        const bool expected = next(input, position, first, key, literal);
+        NETWORK_FUZZ_CHECK(parsed == expected);
+        if (!expected)
+        {
+            NETWORK_FUZZ_CHECK(form.literal_key().empty());
+            NETWORK_FUZZ_CHECK(form.literal_value().empty());
+            break;
+        }
+        NETWORK_FUZZ_CHECK(form.literal_key() == key);
+        NETWORK_FUZZ_CHECK(form.literal_value() == literal);
+
+        std::string decoded;
+        std::string value;
+        const bool valid = oracle::decode(literal, decoded);
+        NETWORK_FUZZ_CHECK(form.value(value) == valid);
+        if (valid)
+        {
+            NETWORK_FUZZ_CHECK(value == decoded);
+        }
+
+        long long number = 0;
+        long long expected_number = 0;
+        const bool numeric = oracle::to_integer(literal, expected_number);
+        NETWORK_FUZZ_CHECK(form.value(number) == numeric);
+        if (numeric)
+        {
+            NETWORK_FUZZ_CHECK(number == expected_number);
+        }
+
+        double real = 0.0;
+        (void)form.value(real);
+        bool flag = false;
+        (void)form.value(flag);
+    }
+    return 0;
+}
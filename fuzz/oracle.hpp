@@ -0,0 +1,180 @@
+#ifndef NETWORK_FUZZ_ORACLE_HPP
+#define NETWORK_FUZZ_ORACLE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <regex>
+#include <string>
+
+// Reference implementations used as differential oracles by the fuzzers.
+// They favour obviousness over speed.
+
+#define NETWORK_FUZZ_CHECK(condition)                                   \
+    do                                                                  \
+    {                                                                   \
+        if (!(condition))                                               \
+        {                                                               \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n",           \
+                         __FILE__, __LINE__, #condition);               \
+            std::abort();                                               \
+        }                                                               \
+    } while (false)
+
+namespace oracle
+{
+
+// std::regex matches recursively, so longer inputs are not compared
+const std::size_t max_regex_size = 512;
+
+// RFC 3986 Section 3
+//
+// The full URI grammar as a regular expression.
+
+inline const std::regex& uri_grammar()
+{
+    static const std::string unreserved = "A-Za-z0-9\\-._~";
+    static const std::string subdelims = "!$&'()*+,;=";
+    static const std::string pct = "%[0-9A-Fa-f]{2}";
+    static const std::string pchar = "(?:[" + unreserved + subdelims + ":@]|" + pct + ")";
+    static const std::string scheme = "[A-Za-z][A-Za-z0-9+\\-.]*";
+    static const std::string userinfo = "(?:[" + unreserved + subdelims + ":]|" + pct + ")*";
+    static const std::string dec_octet = "(?:25[0-5]|2[0-4][0-9]|1[0-9]{2}|[1-9][0-9]|[0-9])";
+    static const std::string ipv4 = dec_octet + "(?:\\." + dec_octet + "){3}";
+    static const std::string h16 = "[0-9A-Fa-f]{1,4}";
+    static const std::string ls32 = "(?:" + h16 + ":" + h16 + "|" + ipv4 + ")";
+    static const std::string ipv6 =
+        "(?:(?:" + h16 + ":){6}" + ls32 +
+        "|::(?:" + h16 + ":){5}" + ls32 +
+        "|(?:" + h16 + ")?::(?:" + h16 + ":){4}" + ls32 +
+        "|(?:(?:" + h16 + ":){0,1}" + h16 + ")?::(?:" + h16 + ":){3}" + ls32 +
+        "|(?:(?:" + h16 + ":){0,2}" + h16 + ")?::(?:" + h16 + ":){2}" + ls32 +
+        "|(?:(?:" + h16 + ":){0,3}" + h16 + ")?::" + h16 + ":" + ls32 +
+        "|(?:(?:" + h16 + ":){0,4}" + h16 + ")?::" + ls32 +
+        "|(?:(?:" + h16 + ":){0,5}" + h16 + ")?::" + h16 +
+        "|(?:(?:" + h16 + ":){0,6}" + h16 + ")?::)";
+    static const std::string ipvfuture = "v[0-9A-Fa-f]+\\.[" + unreserved + subdelims + ":]+";
+    static const std::string regname = "(?:[" + unreserved + subdelims + "]|" + pct + ")*";
+    static const std::string host = "(?:\\[(?:" + ipv6 + "|" + ipvfuture + ")\\]|" + ipv4 + "|" + regname + ")";
+    static const std::string authority = "(?:" + userinfo + "@)?" + host + "(?::[0-9]*)?";
+    static const std::string segment = pchar + "*";
+    static const std::string path_abempty = "(?:/" + segment + ")*";
+    static const std::string path_rootless = pchar + "+" + path_abempty;
+    static const std::string hier_part =
+        "(?://" + authority + path_abempty +
+        "|/(?:" + path_rootless + ")?" +
+        "|" + path_rootless +
+        "|)";
+    static const std::string query = "(?:" + pchar + "|[/?])*";
+    static const std::regex grammar(scheme + ":" + hier_part +
+                                    "(?:\\?" + query + ")?" +
+                                    "(?:#" + query + ")?");
+    return grammar;
+}
+
+inline bool is_uri(const std::string& input)
+{
+    return std::regex_match(input, uri_grammar());
+}
+
+// RFC 3986 Appendix B
+//
+// Splits a valid URI into its components without validation.
+
+struct components
+{
+    std::string scheme;
+    std::string userinfo;
+    std::string host;
+    std::string port;
+    std::string authority;
+    std::string path;
+    std::string query;
+    std::string fragment;
+};
+
+inline components split(const std::string& input)
+{
+    static const std::regex uri("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
+    static const std::regex authority("^(([^@]*)@)?(\\[[^\\]]*\\]|[^:]*)(:(.*))?$");
+
+    components result;
+    std::smatch match;
+    if (!std::regex_match(input, match, uri))
+        return result;
+    result.scheme = match[2];
+    result.authority = match[4];
+    result.path = match[5];
+    result.query = match[7];
+    result.fragment = match[9];
+
+    std::smatch part;
+    if (std::regex_match(result.authority, part, authority))
+    {
+        result.userinfo = part[2];
+        result.host = part[3];
+        if ((result.host.size() >= 2) && (result.host[0] == '['))
+        {
+            result.host = result.host.substr(1, result.host.size() - 2);
+        }
+        result.port = part[5];
+    }
+    return result;
+}
+
+// application/x-www-form-urlencoded
+
+inline bool decode(const std::string& input, std::string& output)
+{
+    output.clear();
+    for (std::string::size_type i = 0; i < input.size(); ++i)
+    {
+        if (input[i] == '+')
+        {
+            output += ' ';
+        }
+        else if (input[i] == '%')
+        {
+            if ((i + 2 >= input.size()) ||
+                !std::isxdigit(static_cast<unsigned char>(input[i + 1])) ||
+                !std::isxdigit(static_cast<unsigned char>(input[i + 2])))
+                return false;
+            output += char(std::strtol(input.substr(i + 1, 2).c_str(), 0, 16));
+            i += 2;
+        }
+        else
+        {
+            output += input[i];
+        }
+    }
+    return true;
+}
+
+inline bool to_integer(const std::string& input, long long& output)
+{
+    std::string text;
+    if (!decode(input, text) || text.empty())
+        return false;
+    const std::string::size_type first = (text[0] == '-') ? 1 : 0;
+    if ((first == text.size()) ||
+        (text.find_first_not_of("0123456789", first) != std::string::npos))
+        return false;
+    errno = 0;
+    output = std::strtoll(text.c_str(), 0, 10);
+    return (errno != ERANGE);
+}
+
+} // namespace oracle
+
+#endif // NETWORK_FUZZ_ORACLE_HPP
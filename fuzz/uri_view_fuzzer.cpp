@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <network/uri_view.hpp>
+#include "oracle.hpp"
+
+namespace
+{
+
+// Exposes the number of characters processed by the parser
+
+template <typename CharT>
+class parser : public network::basic_uri_view<CharT>
+{
+public:
+    typedef network::basic_uri_view<CharT> base_type;
+    using base_type::parse;
+};
+
+typedef parser<char> narrow_parser;
+
+bool is_within(const narrow_parser::string_view& input,
+               const narrow_parser::string_view& part)
+{
+    if (part.empty())
+        return true;
+    return (part.data() >= input.data()) &&
+        (part.data() + part.size() <= input.data() + input.size());
+}
+
+template <typename View>
+std::size_t offset(const View& input, const View& part)
+{
+    return part.empty() ? 0 : std::size_t(part.data() - input.data());
+}
+
+} // anonymous namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size)
+{
+    const narrow_parser::string_view input(reinterpret_cast<const char *>(data), size);
+
+    narrow_parser uri;
+    const std::size_t processed = uri.parse(input);
+    NETWORK_FUZZ_CHECK(processed <= size);
+
+    NETWORK_FUZZ_CHECK(is_within(input, uri.scheme()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.userinfo()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.host()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.port()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.authority()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.path()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.query()));
+    NETWORK_FUZZ_CHECK(is_within(input, uri.fragment()));
+
+    std::size_t count = 0;
+    for (narrow_parser::segment_iterator it = uri.path_segments().begin();
+         it != uri.path_segments().end();
+         ++it)
+    {
+        NETWORK_FUZZ_CHECK(is_within(uri.path(), *it));
+        ++count;
+    }
+    NETWORK_FUZZ_CHECK(count <= uri.path().size() + 1);
+    for (narrow_parser::query_iterator it = uri.query_params().begin();
+         it != uri.query_params().end();
+         ++it)
+    {
+        NETWORK_FUZZ_CHECK(is_within(uri.query(), it->first));
+        NETWORK_FUZZ_CHECK(is_within(uri.query(), it->second));
+    }
+    (void)uri.port_number();
+
+    // Differential check of the accepted prefix against the RFC 3986
+    // grammar and the Appendix B component split
+    if ((processed > 0) && (processed <= oracle::max_regex_size))
+    {
+        const std::string accepted(input.data(), processed);
+        NETWORK_FUZZ_CHECK(oracle::is_uri(accepted));
+
+        const oracle::components expected = oracle::split(accepted);
+        NETWORK_FUZZ_CHECK(expected.scheme == std::string(uri.scheme().data(), uri.scheme().size()));
+        NETWORK_FUZZ_CHECK(expected.authority == std::string(uri.authority().data(), uri.authority().size()));
+        NETWORK_FUZZ_CHECK(expected.userinfo == std::string(uri.userinfo().data(), uri.userinfo().size()));
+        NETWORK_FUZZ_CHECK(expected.host == std::string(uri.host().data(), uri.host().size()));
+        NETWORK_FUZZ_CHECK(expected.port == std::string(uri.port().data(), uri.port().size()));
+        NETWORK_FUZZ_CHECK(expected.path == std::string(uri.path().data(), uri.path().size()));
+        NETWORK_FUZZ_CHECK(expected.query == std::string(uri.query().data(), uri.query().size()));
+        NETWORK_FUZZ_CHECK(expected.fragment == std::string(uri.fragment().data(), uri.fragment().size()));
+    }
+
+    // Every URI is accepted in full, except IPvFuture literals which the
+    // parser does not support yet
+    if ((size <= oracle::max_regex_size) &&
+        (input.find("[v") == narrow_parser::string_view::npos) &&
+        (input.find("[V") == narrow_parser::string_view::npos) &&
+        oracle::is_uri(std::string(input.data(), input.size())))
+    {
+        NETWORK_FUZZ_CHECK(processed == size);
+    }
+
+    // Differential check between character types. Each octet is widened
+    // into one UTF-16 code unit, so component offsets must agree.
+    std::vector<char16_t> wide(data, data + size);
+    const parser<char16_t>::string_view wide_input(wide.data(), wide.size());
+    parser<char16_t> wide_uri;
+    NETWORK_FUZZ_CHECK(wide_uri.parse(wide_input) == processed);
+    NETWORK_FUZZ_CHECK(wide_uri.host().size() == uri.host().size());
+    NETWORK_FUZZ_CHECK(offset(wide_input, wide_uri.host()) == offset(input, uri.host()));
+    NETWORK_FUZZ_CHECK(wide_uri.path().size() == uri.path().size());
+    NETWORK_FUZZ_CHECK(offset(wide_input, wide_uri.path()) == offset(input, uri.path()));
+    NETWORK_FUZZ_CHECK(wide_uri.query().size() == uri.query().size());
+    NETWORK_FUZZ_CHECK(wide_uri.fragment().size() == uri.fragment().size());
+
+    return 0;
+}
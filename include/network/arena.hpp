@@ -0,0 +1,67 @@
+#ifndef NETWORK_ARENA_HPP
+#define NETWORK_ARENA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+
+namespace network
+{
+
+// Bump allocator for character data.
+//
+// Memory is handed out from blocks that double in size up to a limit, and
+// is only returned to the system all at once by release() or destruction.
+
+class arena
+{
+public:
+    typedef std::size_t size_type;
+    typedef char value_type;
+
+    static const size_type default_block_size = 4096;
+    static const size_type default_max_block_size = size_type(1) << 24;
+
+    arena();
+    explicit arena(size_type block_size,
+                   size_type max_block_size = default_max_block_size);
+    ~arena();
+
+    value_type *allocate(size_type size);
+    void release();
+
+    // Number of blocks obtained from the system
+    size_type block_count() const;
+    // Number of bytes handed out since last release
+    size_type size() const;
+
+private:
+    arena(const arena&);
+    arena& operator=(const arena&);
+
+    void add_block(size_type minimum);
+
+private:
+    std::vector<value_type *> blocks;
+    value_type *current;
+    size_type remaining;
+    size_type next_block_size;
+    size_type initial_block_size;
+    size_type max_block_size;
+    size_type used;
+};
+
+} // namespace network
+
+#include <network/detail/arena.ipp>
+
+#endif // NETWORK_ARENA_HPP
@@ -0,0 +1,86 @@
+#ifndef NETWORK_ARENA_URI_HPP
+#define NETWORK_ARENA_URI_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <network/arena.hpp>
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// URI whose characters are stored in an arena.
+//
+// The input is copied once and the components found by uri_view are kept
+// as offsets, so the URI is never parsed again. Copying an arena_uri is
+// shallow and does not validate anything. The arena must outlive it.
+
+class arena_uri
+{
+public:
+    typedef uri_view::string_view string_view;
+    typedef string_view::size_type size_type;
+
+    arena_uri();
+    // Parses input and copies it into the arena
+    arena_uri(arena&, const string_view& input);
+    // Copies input into the arena. The parsed uri must be a view into input.
+    arena_uri(arena&, const string_view& input, const uri_view& parsed);
+
+    // Copies the characters into another arena
+    arena_uri clone(arena&) const;
+
+    string_view text() const;
+    string_view scheme() const;
+    string_view userinfo() const;
+    string_view host() const;
+    string_view port() const;
+    string_view authority() const;
+    string_view path() const;
+    string_view query() const;
+    string_view fragment() const;
+
+private:
+    enum component_index
+    {
+        scheme_index,
+        userinfo_index,
+        host_index,
+        port_index,
+        authority_index,
+        path_index,
+        query_index,
+        fragment_index,
+        component_count
+    };
+
+    struct component
+    {
+        std::uint32_t offset;
+        std::uint32_t size;
+    };
+
+    void assign(arena&, const string_view& input, const uri_view& parsed);
+    void assign(component_index, const string_view& view, const string_view& input);
+    string_view get(component_index) const;
+
+private:
+    const char *data;
+    std::uint32_t length;
+    component components[component_count];
+};
+
+} // namespace network
+
+#include <network/detail/arena_uri.ipp>
+
+#endif // NETWORK_ARENA_URI_HPP
@@ -0,0 +1,36 @@
+#ifndef NETWORK_CONFIG_HPP
+#define NETWORK_CONFIG_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSVC_LANG)
+# define NETWORK_CPLUSPLUS _MSVC_LANG
+#else
+# define NETWORK_CPLUSPLUS __cplusplus
+#endif
+
+#define NETWORK_NOEXCEPT noexcept
+
+// String view type
+//
+// std::basic_string_view is used from C++17 onwards, otherwise
+// boost::basic_string_ref. Define NETWORK_URI_USE_BOOST_STRING_REF to
+// select boost::basic_string_ref regardless of the language version.
+
+#if !defined(NETWORK_URI_USE_BOOST_STRING_REF)
+# if (NETWORK_CPLUSPLUS >= 201703L) && defined(__has_include)
+#  if __has_include(<string_view>)
+#   define NETWORK_URI_USE_STD_STRING_VIEW 1
+#  endif
+# endif
+#endif
+
+#endif // NETWORK_CONFIG_HPP
@@ -0,0 +1,95 @@
+#ifndef NETWORK_DETAIL_ARENA_IPP
+#define NETWORK_DETAIL_ARENA_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+
+inline arena::arena()
+    : current(0),
+      remaining(0),
+      next_block_size(default_block_size),
+      initial_block_size(default_block_size),
+      max_block_size(default_max_block_size),
+      used(0)
+{
+}
+
+inline arena::arena(size_type block_size, size_type max_block_size)
+    : current(0),
+      remaining(0),
+      next_block_size(block_size),
+      initial_block_size(block_size),
+      max_block_size(max_block_size),
+      used(0)
+{
+}
+
+inline arena::~arena()
+{
+    release();
+}
+
+inline arena::value_type *arena::allocate(size_type size)
+{
+    if (size > remaining)
+        add_block(size);
+    value_type *result = current;
+    current += size;
+    remaining -= size;
+    used += size;
+    return result;
+}
+
+inline void arena::release()
+{
+    for (std::vector<value_type *>::iterator it = blocks.begin();
+         it != blocks.end();
+         ++it)
+    {
+        delete[] *it;
+    }
+    blocks.clear();
+    current = 0;
+    remaining = 0;
+    next_block_size = initial_block_size;
+    used = 0;
+}
+
+inline arena::size_type arena::block_count() const
+{
+    return blocks.size();
+}
+
+inline arena::size_type arena::size() const
+{
+    return used;
+}
+
+inline void arena::add_block(size_type minimum)
+{
+    const size_type block_size = (minimum > next_block_size) ? minimum : next_block_size;
+    blocks.reserve(blocks.size() + 1);
+    current = new value_type[block_size];
+    blocks.push_back(current);
+    remaining = block_size;
+    if (next_block_size < max_block_size)
+    {
+        next_block_size *= 2;
+        if (next_block_size > max_block_size)
+            next_block_size = max_block_size;
+    }
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_ARENA_IPP
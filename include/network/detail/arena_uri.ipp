@@ -0,0 +1,159 @@
+#ifndef NETWORK_DETAIL_ARENA_URI_IPP
+#define NETWORK_DETAIL_ARENA_URI_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace network
+{
+
+inline arena_uri::arena_uri()
+    : data(0),
+      length(0)
+{
+    std::memset(components, 0, sizeof(components));
+}
+
+inline arena_uri::arena_uri(arena& storage, const string_view& input)
+    : data(0),
+      length(0)
+{
+    assign(storage, input, uri_view(input));
+}
+
+inline arena_uri::arena_uri(arena& storage,
+                            const string_view& input,
+                            const uri_view& parsed)
+    : data(0),
+      length(0)
+{
+    assign(storage, input, parsed);
+}
+
+inline arena_uri arena_uri::clone(arena& storage) const
+{
+    arena_uri result(*this);
+    if (length > 0)
+    {
+        char *target = storage.allocate(length);
+        std::memcpy(target, data, length);
+        result.data = target;
+    }
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Accessors
+//-----------------------------------------------------------------------------
+
+inline arena_uri::string_view arena_uri::text() const
+{
+    return string_view(data, length);
+}
+
+inline arena_uri::string_view arena_uri::scheme() const
+{
+    return get(scheme_index);
+}
+
+inline arena_uri::string_view arena_uri::userinfo() const
+{
+    return get(userinfo_index);
+}
+
+inline arena_uri::string_view arena_uri::host() const
+{
+    return get(host_index);
+}
+
+inline arena_uri::string_view arena_uri::port() const
+{
+    return get(port_index);
+}
+
+inline arena_uri::string_view arena_uri::authority() const
+{
+    return get(authority_index);
+}
+
+inline arena_uri::string_view arena_uri::path() const
+{
+    return get(path_index);
+}
+
+inline arena_uri::string_view arena_uri::query() const
+{
+    return get(query_index);
+}
+
+inline arena_uri::string_view arena_uri::fragment() const
+{
+    return get(fragment_index);
+}
+
+//-----------------------------------------------------------------------------
+// Implementation
+//-----------------------------------------------------------------------------
+
+inline void arena_uri::assign(arena& storage,
+                              const string_view& input,
+                              const uri_view& parsed)
+{
+    if (input.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("URI too long for arena_uri");
+
+    assign(scheme_index, parsed.scheme(), input);
+    assign(userinfo_index, parsed.userinfo(), input);
+    assign(host_index, parsed.host(), input);
+    assign(port_index, parsed.port(), input);
+    assign(authority_index, parsed.authority(), input);
+    assign(path_index, parsed.path(), input);
+    assign(query_index, parsed.query(), input);
+    assign(fragment_index, parsed.fragment(), input);
+
+    if (!input.empty())
+    {
+        char *target = storage.allocate(input.size());
+        std::memcpy(target, input.data(), input.size());
+        data = target;
+        length = std::uint32_t(input.size());
+    }
+}
+
+inline void arena_uri::assign(component_index index,
+                              const string_view& view,
+                              const string_view& input)
+{
+    if (view.empty())
+    {
+        components[index].offset = 0;
+        components[index].size = 0;
+    }
+    else
+    {
+        components[index].offset = std::uint32_t(view.data() - input.data());
+        components[index].size = std::uint32_t(view.size());
+    }
+}
+
+inline arena_uri::string_view arena_uri::get(component_index index) const
+{
+    if (components[index].size == 0)
+        return string_view();
+    return string_view(data + components[index].offset, components[index].size);
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_ARENA_URI_IPP
@@ -11,61 +11,300 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <network/config.hpp>
+#if defined(__has_include)
+# if __has_include(<charconv>) && (NETWORK_CPLUSPLUS >= 201703L)
+#  include <charconv>
+# endif
+#endif
 #include <network/detail/traits.hpp>
 
 namespace network
 {
 
 //-----------------------------------------------------------------------------
-// detail::form_converter
+// detail::form_decoder
 //-----------------------------------------------------------------------------
 
 namespace detail
 {
 
-template <typename ReturnType>
+// Decodes one character at a time from application/x-www-form-urlencoded
+
+template <typename CharT>
+class form_decoder
+{
+public:
+    typedef typename basic_form_view<CharT>::view_type view_type;
+    typedef typename view_type::value_type value_type;
+
+    form_decoder(const view_type&) NETWORK_NOEXCEPT;
+
+    // Returns false at end of input or on incorrect percent encoding
+    bool next(value_type&) NETWORK_NOEXCEPT;
+    bool failed() const NETWORK_NOEXCEPT;
+
+private:
+    typename view_type::const_iterator current;
+    typename view_type::const_iterator end;
+    bool error;
+};
+
+template <typename CharT>
+form_decoder<CharT>::form_decoder(const view_type& input) NETWORK_NOEXCEPT
+    : current(input.begin()),
+      end(input.end()),
+      error(false)
+{
+}
+
+template <typename CharT>
+bool form_decoder<CharT>::next(value_type& output) NETWORK_NOEXCEPT
+{
+    if (current == end)
+        return false;
+
+    switch (*current)
+    {
+    case traits<CharT>::alpha_plus:
+        output = traits<CharT>::alpha_space;
+        ++current;
+        return true;
+
+    case traits<CharT>::alpha_percent:
+        if ((std::distance(current, end) < 3) ||
+            !traits<CharT>::is_hexdigit(current[1]) ||
+            !traits<CharT>::is_hexdigit(current[2]))
+        {
+            error = true;
+            current = end;
+            return false;
+        }
+        output = value_type((traits<CharT>::hex_to_int(current[1]) << 4) +
+                            traits<CharT>::hex_to_int(current[2]));
+        current += 3;
+        return true;
+
+    default:
+        output = *current;
+        ++current;
+        return true;
+    }
+}
+
+template <typename CharT>
+bool form_decoder<CharT>::failed() const NETWORK_NOEXCEPT
+{
+    return error;
+}
+
+//-----------------------------------------------------------------------------
+// detail::form_converter
+//-----------------------------------------------------------------------------
+
+// String-like types
+
+template <typename CharT, typename ReturnType, typename Enable = void>
 struct form_converter
 {
-    typedef form_view::view_type view_type;
+    typedef typename basic_form_view<CharT>::view_type view_type;
+    typedef typename view_type::value_type value_type;
+
+    static bool convert(const view_type& input, ReturnType& result)
+    {
+        ReturnType output;
+        form_decoder<CharT> decoder(input);
+        value_type current;
+        while (decoder.next(current))
+        {
+            output += current;
+        }
+        if (decoder.failed())
+            return false;
+        result = output;
+        return true;
+    }
+
     static ReturnType convert(const view_type& input)
     {
         ReturnType result;
+        if (!convert(input, result))
+            throw std::runtime_error("Incorrect percent encoding");
+        return result;
+    }
+};
+
+// Integer types
+//
+// Percent decoding and digit accumulation are done in the same pass.
+
+template <typename CharT, typename ReturnType>
+struct form_converter<CharT,
+                      ReturnType,
+                      typename std::enable_if<std::is_integral<ReturnType>::value &&
+                                              !std::is_same<ReturnType, bool>::value>::type>
+{
+    typedef typename basic_form_view<CharT>::view_type view_type;
+    typedef typename view_type::value_type value_type;
+    typedef typename std::make_unsigned<ReturnType>::type unsigned_type;
 
-        typename view_type::const_iterator end = input.end();
-        for (typename view_type::const_iterator it = input.begin();
-             it != end;
-             ++it)
+    static bool convert(const view_type& input, ReturnType& result) NETWORK_NOEXCEPT
+    {
+        form_decoder<CharT> decoder(input);
+        value_type current;
+        if (!decoder.next(current))
+            return false;
+
+        bool negative = false;
+        if (current == traits<CharT>::alpha_minus)
         {
-            switch (*it)
-            {
-            case traits<char>::alpha_plus:
-                result += traits<char>::alpha_space;
-                break;
-
-            case traits<char>::alpha_percent:
-                if (std::distance(it, end) >= 3)
-                {
-                    ++it;
-                    if (!traits<char>::is_hexdigit(*it))
-                        throw std::runtime_error("Incorrect percent encoding");
-                    typename traits<char>::int_type number = traits<char>::hex_to_int(*it) << 4;
-                    ++it;
-                    if (!traits<char>::is_hexdigit(*it))
-                        throw std::runtime_error("Incorrect percent encoding");
-                    number += traits<char>::hex_to_int(*it);
-                    result += std::char_traits<char>::to_char_type(number);
-                }
-                else
-                {
-                    throw std::runtime_error("Incorrect percent encoding");
-                }
-                break;
-
-            default:
-                result += *it;
-                break;
-            }
+            if (!std::is_signed<ReturnType>::value)
+                return false;
+            negative = true;
+            if (!decoder.next(current))
+                return false;
         }
+
+        const unsigned_type limit = negative
+            ? unsigned_type(std::numeric_limits<ReturnType>::max()) + 1
+            : unsigned_type(std::numeric_limits<ReturnType>::max());
+        unsigned_type number = 0;
+        do
+        {
+            if (!traits<CharT>::is_digit(current))
+                return false;
+            const unsigned_type digit = current - traits<CharT>::alpha_0;
+            if (number > (limit - digit) / 10)
+                return false; // Overflow
+            number = number * 10 + digit;
+        } while (decoder.next(current));
+
+        if (decoder.failed())
+            return false;
+        result = negative ? ReturnType(0 - number) : ReturnType(number);
+        return true;
+    }
+
+    // Returns zero on failure
+    static ReturnType convert(const view_type& input) NETWORK_NOEXCEPT
+    {
+        ReturnType result = ReturnType();
+        convert(input, result);
+        return result;
+    }
+};
+
+// Floating-point types
+//
+// Decoded into a stack buffer as floating-point parsing needs look-ahead.
+
+template <typename CharT, typename ReturnType>
+struct form_converter<CharT,
+                      ReturnType,
+                      typename std::enable_if<std::is_floating_point<ReturnType>::value>::type>
+{
+    typedef typename basic_form_view<CharT>::view_type view_type;
+    typedef typename view_type::value_type value_type;
+
+    static bool convert(const view_type& input, ReturnType& result) NETWORK_NOEXCEPT
+    {
+        // Narrowed as numbers only contain ASCII characters
+        char buffer[64];
+        std::size_t size = 0;
+        form_decoder<CharT> decoder(input);
+        value_type current;
+        while (decoder.next(current))
+        {
+            if ((size == sizeof(buffer) - 1) || !traits<CharT>::is_ascii(current))
+                return false;
+            buffer[size++] = char(current);
+        }
+        if (decoder.failed() || (size == 0))
+            return false;
+
+#if defined(__cpp_lib_to_chars)
+        ReturnType output;
+        const std::from_chars_result parsed = std::from_chars(buffer, buffer + size, output);
+        if ((parsed.ec != std::errc()) || (parsed.ptr != buffer + size))
+            return false;
+        result = output;
+#else
+        // Fallback is locale-dependent
+        buffer[size] = 0;
+        char *last = 0;
+        errno = 0;
+        const double output = std::strtod(buffer, &last);
+        if ((last != buffer + size) || (errno == ERANGE))
+            return false;
+        // Narrowing a finite value outside the range of ReturnType is
+        // undefined behavior
+        if (std::isfinite(output) && (std::fabs(output) > std::numeric_limits<ReturnType>::max()))
+            return false;
+        result = ReturnType(output);
+#endif
+        return true;
+    }
+
+    // Returns zero on failure
+    static ReturnType convert(const view_type& input) NETWORK_NOEXCEPT
+    {
+        ReturnType result = ReturnType();
+        convert(input, result);
+        return result;
+    }
+};
+
+// Boolean type
+//
+// Accepts "true", "on", and "1" or "false", "off", and "0" in any case.
+
+template <typename CharT>
+struct form_converter<CharT, bool>
+{
+    typedef typename basic_form_view<CharT>::view_type view_type;
+    typedef typename view_type::value_type value_type;
+
+    static bool convert(const view_type& input, bool& result) NETWORK_NOEXCEPT
+    {
+        char buffer[5];
+        std::size_t size = 0;
+        form_decoder<CharT> decoder(input);
+        value_type current;
+        while (decoder.next(current))
+        {
+            if ((size == sizeof(buffer)) || !traits<CharT>::is_ascii(current))
+                return false;
+            buffer[size++] = char(traits<CharT>::to_lower(current));
+        }
+        if (decoder.failed())
+            return false;
+
+        const typename basic_string_view<char>::type word(buffer, size);
+        if ((word == "true") || (word == "on") || (word == "1"))
+        {
+            result = true;
+            return true;
+        }
+        if ((word == "false") || (word == "off") || (word == "0"))
+        {
+            result = false;
+            return true;
+        }
+        return false;
+    }
+
+    // Returns false on failure
+    static bool convert(const view_type& input) NETWORK_NOEXCEPT
+    {
+        bool result = false;
+        convert(input, result);
         return result;
     }
 };
@@ -73,17 +312,27 @@ struct form_converter
 } // namespace detail
 
 //-----------------------------------------------------------------------------
-// form_view
+// basic_form_view
 //-----------------------------------------------------------------------------
 
-inline form_view::form_view(const view_type& input)
-    : input_view(input),
+template <typename CharT, typename Instrument>
+basic_form_view<CharT, Instrument>::basic_form_view(const view_type& input,
+                                                    mode_type input_mode)
+    : mode(input_mode),
+      input_view(input),
       count()
 {
     next();
 }
 
-inline bool form_view::next()
+template <typename CharT, typename Instrument>
+bool basic_form_view<CharT, Instrument>::next() NETWORK_NOEXCEPT
+{
+    return (mode == query_mode) ? next_query() : next_form();
+}
+
+template <typename CharT, typename Instrument>
+bool basic_form_view<CharT, Instrument>::next_form() NETWORK_NOEXCEPT
 {
     // Parse next key-value pair
     //
@@ -92,6 +341,11 @@ inline bool form_view::next()
     // form ::= ( form-list )?
     // form-list ::= form-key-value ( '&' form-key-value )*
     // form-key-value ::= text '=' text
+    //
+    // The key and value are empty after a failed parse.
+
+    key_view = view_type();
+    value_view = view_type();
 
     if (input_view.empty())
         return false;
@@ -99,24 +353,39 @@ inline bool form_view::next()
     if (count > 0)
     {
         // Skip list separator
-        if (input_view.front() != detail::traits<char>::alpha_ampersand)
+        if (input_view.front() != detail::traits<CharT>::alpha_ampersand)
+        {
+            Instrument::reject(instrument::form_missing_separator);
             return false;
+        }
         input_view.remove_prefix(1);
     }
 
     size_type processed = parse_key(input_view);
+    Instrument::count(instrument::form_key, processed);
     if (processed == 0)
+    {
+        Instrument::reject(instrument::form_empty_key);
         return false;
-    key_view = input_view.substr(0, processed);
+    }
+    const view_type key = input_view.substr(0, processed);
     input_view.remove_prefix(processed);
 
-    if (input_view.front() != detail::traits<char>::alpha_equal)
+    if (input_view.empty() || (input_view.front() != detail::traits<CharT>::alpha_equal))
+    {
+        Instrument::reject(instrument::form_missing_equal);
         return false;
+    }
     input_view.remove_prefix(1);
 
     processed = parse_value(input_view);
+    Instrument::count(instrument::form_value, processed);
     if (processed == 0)
+    {
+        Instrument::reject(instrument::form_empty_value);
         return false;
+    }
+    key_view = key;
     value_view = input_view.substr(0, processed);
     input_view.remove_prefix(processed);
 
@@ -125,28 +394,97 @@ inline bool form_view::next()
     return true;
 }
 
-inline const form_view::view_type& form_view::literal_key() const
+template <typename CharT, typename Instrument>
+bool basic_form_view<CharT, Instrument>::next_query() NETWORK_NOEXCEPT
+{
+    // Parse next query parameter
+    //
+    // query-list ::= query-key-value ( '&' query-key-value )*
+    // query-key-value ::= text ( '=' text? )?
+    //
+    // The value extends to the next '&' and may contain '='.
+
+    key_view = view_type();
+    value_view = view_type();
+
+    while (!input_view.empty())
+    {
+        if (input_view.front() == detail::traits<CharT>::alpha_ampersand)
+        {
+            input_view.remove_prefix(1);
+            continue;
+        }
+
+        size_type processed = parse_key(input_view);
+        Instrument::count(instrument::form_key, processed);
+        const view_type key = input_view.substr(0, processed);
+        input_view.remove_prefix(processed);
+
+        view_type value;
+        if (!input_view.empty() && (input_view.front() == detail::traits<CharT>::alpha_equal))
+        {
+            input_view.remove_prefix(1);
+            processed = parse_query_value(input_view);
+            Instrument::count(instrument::form_value, processed);
+            value = input_view.substr(0, processed);
+            input_view.remove_prefix(processed);
+        }
+
+        if (key.empty())
+        {
+            Instrument::reject(instrument::form_empty_key);
+            continue;
+        }
+        key_view = key;
+        value_view = value;
+        ++count;
+        return true;
+    }
+    return false;
+}
+
+template <typename CharT, typename Instrument>
+const typename basic_form_view<CharT, Instrument>::view_type& basic_form_view<CharT, Instrument>::literal_key() const NETWORK_NOEXCEPT
 {
     return key_view;
 }
 
-inline const form_view::view_type& form_view::literal_value() const
+template <typename CharT, typename Instrument>
+const typename basic_form_view<CharT, Instrument>::view_type& basic_form_view<CharT, Instrument>::literal_value() const NETWORK_NOEXCEPT
 {
     return value_view;
 }
 
-inline form_view::string_type form_view::key() const
+template <typename CharT, typename Instrument>
+typename basic_form_view<CharT, Instrument>::string_type basic_form_view<CharT, Instrument>::key() const
 {
-    return detail::form_converter<string_type>::convert(key_view);
+    return detail::form_converter<CharT, string_type>::convert(key_view);
 }
 
+template <typename CharT, typename Instrument>
 template <typename ReturnType>
-ReturnType form_view::value() const
+ReturnType basic_form_view<CharT, Instrument>::value() const
 {
-    return detail::form_converter<ReturnType>::convert(value_view);
+    Instrument::count(instrument::form_decode, value_view.size());
+    return detail::form_converter<CharT, ReturnType>::convert(value_view);
 }
 
-form_view::size_type form_view::parse_key(const view_type& view)
+template <typename CharT, typename Instrument>
+template <typename ReturnType>
+bool basic_form_view<CharT, Instrument>::value(ReturnType& result) const
+{
+    if (!detail::form_converter<CharT, ReturnType>::convert(value_view, result))
+    {
+        Instrument::count(instrument::form_decode, 0);
+        Instrument::reject(instrument::form_invalid_value);
+        return false;
+    }
+    Instrument::count(instrument::form_decode, value_view.size());
+    return true;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_form_view<CharT, Instrument>::size_type basic_form_view<CharT, Instrument>::parse_key(const view_type& view)
 {
     // All characters until =, &, or EOF
 
@@ -157,19 +495,38 @@ form_view::size_type form_view::parse_key(const view_type& view)
          it != end;
          ++it)
     {
-        if (*it == detail::traits<char>::alpha_equal)
+        if (*it == detail::traits<CharT>::alpha_equal)
             break;
-        if (*it == detail::traits<char>::alpha_ampersand)
+        if (*it == detail::traits<CharT>::alpha_ampersand)
             break;
     }
     return std::distance(begin, it);
 }
 
-form_view::size_type form_view::parse_value(const view_type& view)
+template <typename CharT, typename Instrument>
+typename basic_form_view<CharT, Instrument>::size_type basic_form_view<CharT, Instrument>::parse_value(const view_type& view)
 {
     return parse_key(view);
 }
 
+template <typename CharT, typename Instrument>
+typename basic_form_view<CharT, Instrument>::size_type basic_form_view<CharT, Instrument>::parse_query_value(const view_type& view)
+{
+    // All characters until & or EOF
+
+    typename view_type::const_iterator begin = view.begin();
+    typename view_type::const_iterator end = view.end();
+    typename view_type::const_iterator it = begin;
+    for (;
+         it != end;
+         ++it)
+    {
+        if (*it == detail::traits<CharT>::alpha_ampersand)
+            break;
+    }
+    return std::distance(begin, it);
+}
+
 } // namespace network
 
 #endif // NETWORK_DETAIL_FORM_VIEW_IPP
@@ -0,0 +1,571 @@
+#ifndef NETWORK_DETAIL_IDNA_IPP
+#define NETWORK_DETAIL_IDNA_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <network/detail/traits.hpp>
+
+namespace network
+{
+
+//-----------------------------------------------------------------------------
+// punycode
+//-----------------------------------------------------------------------------
+
+inline punycode::value_type *punycode::encode(const code_point *first,
+                                              const code_point *last,
+                                              value_type *output,
+                                              value_type *output_last)
+{
+    // RFC 3492 Section 6.3
+
+    const std::uint32_t maxint = 0xFFFFFFFF;
+    const std::uint32_t size = std::uint32_t(last - first);
+
+    // Basic code points are copied first
+    std::uint32_t handled = 0;
+    for (const code_point *it = first; it != last; ++it)
+    {
+        if (*it > 0x10FFFF)
+            return 0;
+        if (*it < code_point(initial_n))
+        {
+            if (output == output_last)
+                return 0;
+            *output++ = value_type(*it);
+            ++handled;
+        }
+    }
+    const std::uint32_t basic = handled;
+    if (basic > 0)
+    {
+        if (output == output_last)
+            return 0;
+        *output++ = value_type(delimiter);
+    }
+
+    std::uint32_t n = initial_n;
+    std::uint32_t delta = 0;
+    std::uint32_t bias = initial_bias;
+
+    while (handled < size)
+    {
+        // Next smallest code point to insert
+        std::uint32_t m = maxint;
+        for (const code_point *it = first; it != last; ++it)
+        {
+            if ((*it >= n) && (*it < m))
+                m = *it;
+        }
+        if ((m - n) > (maxint - delta) / (handled + 1))
+            return 0;
+        delta += (m - n) * (handled + 1);
+        n = m;
+
+        for (const code_point *it = first; it != last; ++it)
+        {
+            if (*it < n)
+            {
+                if (++delta == 0)
+                    return 0;
+            }
+            else if (*it == n)
+            {
+                // Variable-length integer for delta
+                std::uint32_t q = delta;
+                for (std::uint32_t k = base; ; k += base)
+                {
+                    const std::uint32_t t = threshold(k, bias);
+                    if (q < t)
+                        break;
+                    if (output == output_last)
+                        return 0;
+                    *output++ = encode_digit(t + (q - t) % (base - t));
+                    q = (q - t) / (base - t);
+                }
+                if (output == output_last)
+                    return 0;
+                *output++ = encode_digit(q);
+                bias = adapt(delta, handled + 1, handled == basic);
+                delta = 0;
+                ++handled;
+            }
+        }
+        ++delta;
+        ++n;
+    }
+    return output;
+}
+
+inline punycode::code_point *punycode::decode(const value_type *first,
+                                              const value_type *last,
+                                              code_point *output,
+                                              code_point *output_last)
+{
+    // RFC 3492 Section 6.2
+
+    const std::uint32_t maxint = 0xFFFFFFFF;
+
+    // Basic code points are before the last delimiter
+    const value_type *basic_last = first;
+    for (const value_type *it = first; it != last; ++it)
+    {
+        if (*it == value_type(delimiter))
+            basic_last = it;
+    }
+    code_point *current = output;
+    for (const value_type *it = first; it != basic_last; ++it)
+    {
+        const unsigned char value = *it;
+        if (value >= initial_n)
+            return 0;
+        if (current == output_last)
+            return 0;
+        *current++ = value;
+    }
+
+    std::uint32_t n = initial_n;
+    std::uint32_t i = 0;
+    std::uint32_t bias = initial_bias;
+
+    const value_type *input = (basic_last == first) ? first : basic_last + 1;
+    while (input != last)
+    {
+        const std::uint32_t previous = i;
+        std::uint32_t w = 1;
+        for (std::uint32_t k = base; ; k += base)
+        {
+            if (input == last)
+                return 0;
+            const std::uint32_t digit = decode_digit(*input++);
+            if (digit >= base)
+                return 0;
+            if (digit > (maxint - i) / w)
+                return 0;
+            i += digit * w;
+            const std::uint32_t t = threshold(k, bias);
+            if (digit < t)
+                break;
+            if (w > maxint / (base - t))
+                return 0;
+            w *= (base - t);
+        }
+
+        const std::uint32_t count = std::uint32_t(current - output) + 1;
+        bias = adapt(i - previous, count, previous == 0);
+        if (i / count > maxint - n)
+            return 0;
+        n += i / count;
+        i %= count;
+
+        // Surrogates and values beyond Unicode cannot be encoded as UTF-8
+        if ((n > 0x10FFFF) || ((n >= 0xD800) && (n <= 0xDFFF)))
+            return 0;
+        if (current == output_last)
+            return 0;
+        std::copy_backward(output + i, current, current + 1);
+        output[i] = n;
+        ++current;
+        ++i;
+    }
+    return current;
+}
+
+inline std::uint32_t punycode::threshold(std::uint32_t k, std::uint32_t bias)
+{
+    if (k <= bias)
+        return tmin;
+    if (k >= bias + tmax)
+        return tmax;
+    return k - bias;
+}
+
+inline std::uint32_t punycode::adapt(std::uint32_t delta,
+                                     std::uint32_t count,
+                                     bool first)
+{
+    // RFC 3492 Section 6.1
+
+    delta = first ? delta / damp : delta / 2;
+    delta += delta / count;
+
+    std::uint32_t k = 0;
+    while (delta > ((base - tmin) * tmax) / 2)
+    {
+        delta /= base - tmin;
+        k += base;
+    }
+    return k + (base - tmin + 1) * delta / (delta + skew);
+}
+
+inline punycode::value_type punycode::encode_digit(std::uint32_t digit)
+{
+    // 0-25 are "a" to "z" and 26-35 are "0" to "9"
+    typedef detail::traits<value_type> traits;
+    return (digit < 26)
+        ? value_type(traits::alpha_a + digit)
+        : value_type(traits::alpha_0 + digit - 26);
+}
+
+inline std::uint32_t punycode::decode_digit(value_type value)
+{
+    typedef detail::traits<value_type> traits;
+    if (traits::is_digit(value))
+        return value - traits::alpha_0 + 26;
+    if (traits::is_alpha(value))
+        return traits::to_lower(value) - traits::alpha_a;
+    return base;
+}
+
+//-----------------------------------------------------------------------------
+// idna
+//-----------------------------------------------------------------------------
+
+inline bool idna::is_ascii(const string_view& host)
+{
+    // Checks eight characters per step. A character is non-ASCII if its
+    // high bit is set, and a "%" leaves a zero byte in word ^ percents.
+
+    typedef detail::traits<value_type> traits;
+    const std::uint64_t low = 0x0101010101010101ULL;
+    const std::uint64_t high = 0x8080808080808080ULL;
+    const std::uint64_t percents = low * traits::alpha_percent;
+
+    const value_type *data = host.data();
+    const size_type size = host.size();
+    std::uint64_t bits = 0;
+    size_type i = 0;
+    for (; size - i >= sizeof(std::uint64_t); i += sizeof(std::uint64_t))
+    {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        const std::uint64_t match = word ^ percents;
+        bits |= word | ((match - low) & ~match);
+    }
+    for (; i < size; ++i)
+    {
+        const unsigned char value = data[i];
+        bits |= (value == traits::alpha_percent) ? high : value;
+    }
+    return (bits & high) == 0;
+}
+
+inline idna::value_type *idna::to_ascii(const string_view& host,
+                                        value_type *buffer,
+                                        size_type size)
+{
+    // RFC 3490 Section 4.1
+
+    if (is_ascii(host))
+    {
+        if (host.size() > size)
+            return 0;
+        return copy_lower(host, buffer);
+    }
+    return convert(host, buffer, buffer + size, &idna::encode_label);
+}
+
+inline idna::value_type *idna::to_unicode(const string_view& host,
+                                          value_type *buffer,
+                                          size_type size)
+{
+    // RFC 3490 Section 4.2
+
+    return convert(host, buffer, buffer + size, &idna::decode_label);
+}
+
+inline idna::value_type *idna::convert(const string_view& host,
+                                       value_type *output,
+                                       value_type *output_last,
+                                       label_function convert_label)
+{
+    // Splits the host into labels of lowercased code points
+
+    code_point label[label_limit];
+    size_type label_size = 0;
+    size_type position = 0;
+
+    for (;;)
+    {
+        const bool at_end = (position == host.size());
+        code_point value = 0;
+        if (!at_end && !next_code_point(host, position, value))
+            return 0;
+
+        if (at_end || is_separator(value))
+        {
+            output = convert_label(label, label + label_size, output, output_last);
+            if (!output)
+                return 0;
+            if (at_end)
+                break;
+            if (output == output_last)
+                return 0;
+            *output++ = detail::traits<value_type>::alpha_dot;
+            label_size = 0;
+        }
+        else
+        {
+            if (label_size == label_limit)
+                return 0;
+            label[label_size++] = detail::traits<code_point>::to_lower(value);
+        }
+    }
+    return output;
+}
+
+inline idna::value_type *idna::copy_lower(const string_view& input,
+                                          value_type *output)
+{
+    // Branch-free so the compiler can vectorize the loop
+    typedef detail::traits<value_type> traits;
+    const value_type *data = input.data();
+    const size_type size = input.size();
+    for (size_type i = 0; i < size; ++i)
+    {
+        const unsigned char value = data[i];
+        const bool is_upper = (unsigned char)(value - traits::alpha_A) < 26;
+        output[i] = value_type(value + is_upper * (traits::alpha_a - traits::alpha_A));
+    }
+    return output + size;
+}
+
+inline idna::value_type *idna::encode_label(const code_point *first,
+                                            const code_point *last,
+                                            value_type *output,
+                                            value_type *output_last)
+{
+    bool is_basic = true;
+    for (const code_point *it = first; it != last; ++it)
+    {
+        is_basic = is_basic && (*it < 0x80);
+    }
+
+    if (is_basic)
+    {
+        if (size_type(last - first) > size_type(output_last - output))
+            return 0;
+        for (const code_point *it = first; it != last; ++it)
+        {
+            *output++ = value_type(*it);
+        }
+        return output;
+    }
+
+    typedef detail::traits<value_type> traits;
+    value_type *const label = output;
+    if (output_last - output < 4)
+        return 0;
+    *output++ = traits::alpha_x;
+    *output++ = traits::alpha_n;
+    *output++ = traits::alpha_minus;
+    *output++ = traits::alpha_minus;
+    output = punycode::encode(first, last, output, output_last);
+    if (!output || (output - label > label_limit))
+        return 0;
+    return output;
+}
+
+inline idna::value_type *idna::decode_label(const code_point *first,
+                                            const code_point *last,
+                                            value_type *output,
+                                            value_type *output_last)
+{
+    const code_point *decoded = first;
+    const code_point *decoded_last = last;
+    code_point buffer[label_limit];
+
+    if (is_ace_prefix(first, last))
+    {
+        // The ACE label has only basic code points, which are already
+        // lowercased
+        value_type ace[label_limit];
+        size_type ace_size = 0;
+        for (const code_point *it = first + 4; it != last; ++it)
+        {
+            if (*it >= 0x80)
+                return 0;
+            ace[ace_size++] = value_type(*it);
+        }
+        decoded = buffer;
+        decoded_last = punycode::decode(ace, ace + ace_size, buffer, buffer + label_limit);
+        if (!decoded_last)
+            return 0;
+
+        // RFC 3490 Section 4.2 step 7 rejects labels that ToASCII does not
+        // encode back into the same label
+        value_type check[label_limit];
+        const value_type *check_last = encode_label(decoded, decoded_last, check, check + label_limit);
+        if (!check_last || (size_type(check_last - check) != size_type(last - first)))
+            return 0;
+        for (size_type i = 0; i < size_type(last - first); ++i)
+        {
+            if (code_point(static_cast<unsigned char>(check[i])) != first[i])
+                return 0;
+        }
+    }
+
+    for (const code_point *it = decoded; it != decoded_last; ++it)
+    {
+        output = write_utf8(*it, output, output_last);
+        if (!output)
+            return 0;
+    }
+    return output;
+}
+
+inline bool idna::is_separator(code_point value)
+{
+    // RFC 3490 Section 3.1
+    switch (value)
+    {
+    case 0x002E: // full stop
+    case 0x3002: // ideographic full stop
+    case 0xFF0E: // fullwidth full stop
+    case 0xFF61: // halfwidth ideographic full stop
+        return true;
+    default:
+        return false;
+    }
+}
+
+inline bool idna::is_ace_prefix(const code_point *first, const code_point *last)
+{
+    typedef detail::traits<code_point> traits;
+    return (last - first >= 4) &&
+        (first[0] == traits::alpha_x) &&
+        (first[1] == traits::alpha_n) &&
+        (first[2] == traits::alpha_minus) &&
+        (first[3] == traits::alpha_minus);
+}
+
+inline bool idna::next_octet(const string_view& input,
+                             size_type& position,
+                             std::uint8_t& octet)
+{
+    typedef detail::traits<value_type> traits;
+
+    if (input[position] != traits::alpha_percent)
+    {
+        octet = static_cast<unsigned char>(input[position]);
+        ++position;
+        return true;
+    }
+    if ((input.size() - position < 3) ||
+        !traits::is_hexdigit(input[position + 1]) ||
+        !traits::is_hexdigit(input[position + 2]))
+    {
+        return false;
+    }
+    octet = std::uint8_t(traits::hex_to_int(input[position + 1]) * 16 +
+                         traits::hex_to_int(input[position + 2]));
+    position += 3;
+    return true;
+}
+
+inline bool idna::next_code_point(const string_view& input,
+                                  size_type& position,
+                                  code_point& value)
+{
+    // RFC 3629 Section 3
+
+    std::uint8_t octet = 0;
+    if (!next_octet(input, position, octet))
+        return false;
+    if (octet < 0x80)
+    {
+        value = octet;
+        return true;
+    }
+
+    size_type trailing = 0;
+    code_point minimum = 0;
+    if ((octet & 0xE0) == 0xC0)
+    {
+        trailing = 1;
+        minimum = 0x80;
+        value = octet & 0x1F;
+    }
+    else if ((octet & 0xF0) == 0xE0)
+    {
+        trailing = 2;
+        minimum = 0x800;
+        value = octet & 0x0F;
+    }
+    else if ((octet & 0xF8) == 0xF0)
+    {
+        trailing = 3;
+        minimum = 0x10000;
+        value = octet & 0x07;
+    }
+    else
+    {
+        return false;
+    }
+
+    for (; trailing > 0; --trailing)
+    {
+        if ((position == input.size()) || !next_octet(input, position, octet))
+            return false;
+        if ((octet & 0xC0) != 0x80)
+            return false;
+        value = (value << 6) | (octet & 0x3F);
+    }
+
+    // Overlong encodings, surrogates, and values beyond Unicode
+    return (value >= minimum) &&
+        (value <= 0x10FFFF) &&
+        ((value < 0xD800) || (value > 0xDFFF));
+}
+
+inline idna::value_type *idna::write_utf8(code_point value,
+                                          value_type *output,
+                                          value_type *output_last)
+{
+    const size_type available = size_type(output_last - output);
+    if (value < 0x80)
+    {
+        if (available < 1)
+            return 0;
+        *output++ = value_type(value);
+    }
+    else if (value < 0x800)
+    {
+        if (available < 2)
+            return 0;
+        *output++ = value_type(0xC0 | (value >> 6));
+        *output++ = value_type(0x80 | (value & 0x3F));
+    }
+    else if (value < 0x10000)
+    {
+        if (available < 3)
+            return 0;
+        *output++ = value_type(0xE0 | (value >> 12));
+        *output++ = value_type(0x80 | ((value >> 6) & 0x3F));
+        *output++ = value_type(0x80 | (value & 0x3F));
+    }
+    else
+    {
+        if (available < 4)
+            return 0;
+        *output++ = value_type(0xF0 | (value >> 18));
+        *output++ = value_type(0x80 | ((value >> 12) & 0x3F));
+        *output++ = value_type(0x80 | ((value >> 6) & 0x3F));
+        *output++ = value_type(0x80 | (value & 0x3F));
+    }
+    return output;
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_IDNA_IPP
@@ -0,0 +1,79 @@
+#ifndef NETWORK_DETAIL_INSTRUMENT_IPP
+#define NETWORK_DETAIL_INSTRUMENT_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+namespace instrument
+{
+
+inline const char *name(production value) NETWORK_NOEXCEPT
+{
+    static const char *const names[production_count] =
+    {
+        "URI",
+        "scheme",
+        "hier-part",
+        "authority",
+        "userinfo",
+        "host",
+        "IP-literal",
+        "IPv4address",
+        "IPv6address",
+        "IPv6address/1",
+        "IPv6address/2",
+        "IPv6address/3",
+        "IPv6address/4",
+        "IPv6address/5",
+        "h16",
+        "ls32",
+        "reg-name",
+        "dec-octet",
+        "port",
+        "path-abempty",
+        "path-absolute",
+        "path-rootless",
+        "segment",
+        "query",
+        "fragment",
+        "pchar",
+        "pct-encoded",
+        "form-key",
+        "form-value",
+        "form-decode"
+    };
+    return (value < production_count) ? names[value] : "";
+}
+
+inline const char *name(rejection value) NETWORK_NOEXCEPT
+{
+    static const char *const names[rejection_count] =
+    {
+        "missing scheme",
+        "missing colon",
+        "invalid authority",
+        "invalid IP-literal",
+        "invalid percent-encoding",
+        "trailing input",
+        "form missing separator",
+        "form empty key",
+        "form missing equal",
+        "form empty value",
+        "form invalid value"
+    };
+    return (value < rejection_count) ? names[value] : "";
+}
+
+} // namespace instrument
+} // namespace network
+
+#endif // NETWORK_DETAIL_INSTRUMENT_IPP
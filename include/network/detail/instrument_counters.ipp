@@ -0,0 +1,169 @@
+#ifndef NETWORK_DETAIL_INSTRUMENT_COUNTERS_IPP
+#define NETWORK_DETAIL_INSTRUMENT_COUNTERS_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+namespace instrument
+{
+
+//-----------------------------------------------------------------------------
+// statistics
+//-----------------------------------------------------------------------------
+
+inline statistics::statistics()
+{
+    for (std::size_t i = 0; i < production_count; ++i)
+    {
+        productions[i].calls = 0;
+        productions[i].misses = 0;
+        productions[i].bytes = 0;
+    }
+    for (std::size_t i = 0; i < rejection_count; ++i)
+    {
+        rejections[i] = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// counters
+//-----------------------------------------------------------------------------
+
+inline void counters::count(production which, std::size_t processed) NETWORK_NOEXCEPT
+{
+    block& counter = local();
+    increment(counter.calls[which], 1);
+    if (processed == 0)
+    {
+        increment(counter.misses[which], 1);
+    }
+    else
+    {
+        increment(counter.bytes[which], processed);
+    }
+}
+
+inline void counters::reject(rejection which) NETWORK_NOEXCEPT
+{
+    increment(local().rejections[which], 1);
+}
+
+inline statistics counters::collect()
+{
+    registry& all = global();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    statistics result = all.retired;
+    for (const block *current = all.head; current; current = current->next)
+    {
+        add(result, *current);
+    }
+    return result;
+}
+
+inline void counters::reset()
+{
+    registry& all = global();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    all.retired = statistics();
+    for (block *current = all.head; current; current = current->next)
+    {
+        for (std::size_t i = 0; i < production_count; ++i)
+        {
+            current->calls[i].store(0, std::memory_order_relaxed);
+            current->misses[i].store(0, std::memory_order_relaxed);
+            current->bytes[i].store(0, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < rejection_count; ++i)
+        {
+            current->rejections[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline counters::block& counters::local() NETWORK_NOEXCEPT
+{
+    static thread_local block instance;
+    return instance;
+}
+
+inline counters::registry& counters::global() NETWORK_NOEXCEPT
+{
+    static registry instance;
+    return instance;
+}
+
+inline void counters::increment(counter_type& counter, std::uint64_t amount) NETWORK_NOEXCEPT
+{
+    // Single writer, so a read-modify-write instruction is not needed. A
+    // concurrent reset() may be lost, which is acceptable for statistics.
+    counter.store(counter.load(std::memory_order_relaxed) + amount,
+                  std::memory_order_relaxed);
+}
+
+inline void counters::add(statistics& result, const block& counter)
+{
+    for (std::size_t i = 0; i < production_count; ++i)
+    {
+        result.productions[i].calls += counter.calls[i].load(std::memory_order_relaxed);
+        result.productions[i].misses += counter.misses[i].load(std::memory_order_relaxed);
+        result.productions[i].bytes += counter.bytes[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < rejection_count; ++i)
+    {
+        result.rejections[i] += counter.rejections[i].load(std::memory_order_relaxed);
+    }
+}
+
+inline counters::block::block()
+{
+    for (std::size_t i = 0; i < production_count; ++i)
+    {
+        calls[i].store(0, std::memory_order_relaxed);
+        misses[i].store(0, std::memory_order_relaxed);
+        bytes[i].store(0, std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < rejection_count; ++i)
+    {
+        rejections[i].store(0, std::memory_order_relaxed);
+    }
+
+    registry& all = global();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    next = all.head;
+    all.head = this;
+}
+
+inline counters::block::~block()
+{
+    // Fold into the retired counters when the thread exits
+    registry& all = global();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    add(all.retired, *this);
+    for (block **current = &all.head; *current; current = &(*current)->next)
+    {
+        if (*current == this)
+        {
+            *current = next;
+            break;
+        }
+    }
+}
+
+inline counters::registry::registry()
+    : head(0)
+{
+}
+
+} // namespace instrument
+} // namespace network
+
+#endif // NETWORK_DETAIL_INSTRUMENT_COUNTERS_IPP
@@ -0,0 +1,287 @@
+#ifndef NETWORK_DETAIL_INTERN_POOL_IPP
+#define NETWORK_DETAIL_INTERN_POOL_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdexcept>
+#include <network/detail/traits.hpp>
+
+namespace network
+{
+
+//-----------------------------------------------------------------------------
+// intern_pool::entry
+//-----------------------------------------------------------------------------
+
+inline intern_pool::entry::entry(std::uint64_t hash,
+                                 id_type id,
+                                 const string_view& input)
+    : hash(hash),
+      id(id)
+{
+    text.reserve(input.size());
+    for (string_view::const_iterator it = input.begin(); it != input.end(); ++it)
+    {
+        text += detail::traits<char>::to_lower(*it);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// intern_pool::table
+//-----------------------------------------------------------------------------
+
+inline intern_pool::table::table(size_type capacity)
+    : mask(capacity - 1),
+      slots(new slot_type[capacity])
+{
+    for (size_type i = 0; i < capacity; ++i)
+    {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+inline intern_pool::table::~table()
+{
+    delete[] slots;
+}
+
+//-----------------------------------------------------------------------------
+// intern_pool::shard
+//-----------------------------------------------------------------------------
+
+inline intern_pool::shard::shard()
+    : current(new table(initial_capacity)),
+      count(0)
+{
+    for (size_type i = 0; i < max_chunks; ++i)
+    {
+        chunks[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// intern_pool
+//-----------------------------------------------------------------------------
+
+inline intern_pool::intern_pool()
+{
+}
+
+inline intern_pool::~intern_pool()
+{
+    for (size_type i = 0; i < shard_count; ++i)
+    {
+        shard& current = shards[i];
+        const size_type count = current.count.load(std::memory_order_relaxed);
+        for (size_type index = 0; index < count; ++index)
+        {
+            size_type chunk;
+            size_type offset;
+            locate(index, chunk, offset);
+            delete current.chunks[chunk].load(std::memory_order_relaxed)[offset].load(std::memory_order_relaxed);
+        }
+        for (size_type chunk = 0; chunk < max_chunks; ++chunk)
+        {
+            delete[] current.chunks[chunk].load(std::memory_order_relaxed);
+        }
+        for (size_type k = 0; k < current.retired.size(); ++k)
+        {
+            delete current.retired[k];
+        }
+        delete current.current.load(std::memory_order_relaxed);
+    }
+}
+
+inline intern_pool::id_type intern_pool::insert(const string_view& input)
+{
+    const std::uint64_t hash = hash_folded(input);
+    shard& current = shard_of(hash);
+
+    // Most components have been seen before
+    const entry *found = search(*current.current.load(std::memory_order_acquire),
+                                hash,
+                                input);
+    if (found)
+        return found->id;
+
+    std::lock_guard<std::mutex> lock(current.mutex);
+
+    // Another thread may have inserted it while waiting for the lock
+    found = search(*current.current.load(std::memory_order_relaxed), hash, input);
+    if (found)
+        return found->id;
+
+    const size_type index = current.count.load(std::memory_order_relaxed);
+    if (index >= (size_type(npos) >> shard_bits))
+        throw std::length_error("Intern pool shard is full");
+
+    table *target = current.current.load(std::memory_order_relaxed);
+    if ((index + 1) * 2 > target->mask + 1)
+    {
+        grow(current);
+        target = current.current.load(std::memory_order_relaxed);
+    }
+
+    size_type chunk;
+    size_type offset;
+    locate(index, chunk, offset);
+    slot_type *storage = current.chunks[chunk].load(std::memory_order_relaxed);
+    if (storage == 0)
+    {
+        const size_type chunk_size = first_chunk_size << chunk;
+        storage = new slot_type[chunk_size];
+        for (size_type i = 0; i < chunk_size; ++i)
+        {
+            storage[i].store(0, std::memory_order_relaxed);
+        }
+        current.chunks[chunk].store(storage, std::memory_order_release);
+    }
+
+    const id_type id = id_type((index << shard_bits) | (hash >> (64 - shard_bits)));
+    const entry *created = new entry(hash, id, input);
+    storage[offset].store(created, std::memory_order_release);
+    place(*target, created);
+    current.count.store(index + 1, std::memory_order_release);
+    return id;
+}
+
+inline intern_pool::id_type intern_pool::find(const string_view& input) const
+{
+    const std::uint64_t hash = hash_folded(input);
+    const entry *found = search(*shard_of(hash).current.load(std::memory_order_acquire),
+                                hash,
+                                input);
+    return found ? found->id : npos;
+}
+
+inline intern_pool::string_view intern_pool::at(id_type id) const
+{
+    const shard& current = shards[id & (shard_count - 1)];
+    size_type chunk;
+    size_type offset;
+    locate(id >> shard_bits, chunk, offset);
+    if (chunk >= max_chunks)
+        return string_view();
+    const slot_type *storage = current.chunks[chunk].load(std::memory_order_acquire);
+    if (storage == 0)
+        return string_view();
+    const entry *found = storage[offset].load(std::memory_order_acquire);
+    if (found == 0)
+        return string_view();
+    return string_view(found->text.data(), found->text.size());
+}
+
+inline intern_pool::size_type intern_pool::size() const
+{
+    size_type result = 0;
+    for (size_type i = 0; i < shard_count; ++i)
+    {
+        result += shards[i].count.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+inline std::uint64_t intern_pool::hash_folded(const string_view& input)
+{
+    // FNV-1a
+    std::uint64_t result = 0xCBF29CE484222325ULL;
+    for (string_view::const_iterator it = input.begin(); it != input.end(); ++it)
+    {
+        result ^= static_cast<unsigned char>(detail::traits<char>::to_lower(*it));
+        result *= 0x100000001B3ULL;
+    }
+    return result;
+}
+
+inline bool intern_pool::equal_folded(const std::string& folded,
+                                      const string_view& input)
+{
+    if (folded.size() != input.size())
+        return false;
+    for (size_type i = 0; i < folded.size(); ++i)
+    {
+        if (folded[i] != detail::traits<char>::to_lower(input[i]))
+            return false;
+    }
+    return true;
+}
+
+inline void intern_pool::locate(size_type index,
+                                size_type& chunk,
+                                size_type& offset)
+{
+    // Chunk k holds first_chunk_size * 2^k entries
+    const size_type quotient = index / first_chunk_size + 1;
+    chunk = 0;
+    while ((quotient >> (chunk + 1)) != 0)
+        ++chunk;
+    offset = index - first_chunk_size * ((size_type(1) << chunk) - 1);
+}
+
+inline const intern_pool::entry *intern_pool::search(const table& where,
+                                                     std::uint64_t hash,
+                                                     const string_view& input)
+{
+    for (size_type position = hash & where.mask;
+         ;
+         position = (position + 1) & where.mask)
+    {
+        const entry *candidate = where.slots[position].load(std::memory_order_acquire);
+        if (candidate == 0)
+            return 0;
+        if ((candidate->hash == hash) && equal_folded(candidate->text, input))
+            return candidate;
+    }
+}
+
+inline void intern_pool::place(table& where, const entry *value)
+{
+    for (size_type position = value->hash & where.mask;
+         ;
+         position = (position + 1) & where.mask)
+    {
+        if (where.slots[position].load(std::memory_order_relaxed) == 0)
+        {
+            where.slots[position].store(value, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+inline intern_pool::shard& intern_pool::shard_of(std::uint64_t hash)
+{
+    return shards[hash >> (64 - shard_bits)];
+}
+
+inline const intern_pool::shard& intern_pool::shard_of(std::uint64_t hash) const
+{
+    return shards[hash >> (64 - shard_bits)];
+}
+
+inline void intern_pool::grow(shard& current)
+{
+    // Called with the shard mutex held
+    table *old = current.current.load(std::memory_order_relaxed);
+    current.retired.reserve(current.retired.size() + 1);
+    table *replacement = new table(2 * (old->mask + 1));
+    for (size_type i = 0; i <= old->mask; ++i)
+    {
+        const entry *value = old->slots[i].load(std::memory_order_relaxed);
+        if (value)
+            place(*replacement, value);
+    }
+    current.retired.push_back(old);
+    current.current.store(replacement, std::memory_order_release);
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_INTERN_POOL_IPP
@@ -0,0 +1,45 @@
+#ifndef NETWORK_DETAIL_RANGE_HPP
+#define NETWORK_DETAIL_RANGE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+namespace detail
+{
+
+// Pair of iterators usable with range-based for loops
+
+template <typename Iterator>
+class range
+{
+public:
+    typedef Iterator iterator;
+    typedef Iterator const_iterator;
+    typedef typename Iterator::value_type value_type;
+
+    range(const iterator& first, const iterator& last);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    bool empty() const;
+
+private:
+    iterator first;
+    iterator last;
+};
+
+} // namespace detail
+} // namespace network
+
+#include <network/detail/range.ipp>
+
+#endif // NETWORK_DETAIL_RANGE_HPP
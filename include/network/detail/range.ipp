@@ -0,0 +1,47 @@
+#ifndef NETWORK_DETAIL_RANGE_IPP
+#define NETWORK_DETAIL_RANGE_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+namespace detail
+{
+
+template <typename Iterator>
+range<Iterator>::range(const iterator& first, const iterator& last)
+    : first(first),
+      last(last)
+{
+}
+
+template <typename Iterator>
+typename range<Iterator>::const_iterator range<Iterator>::begin() const
+{
+    return first;
+}
+
+template <typename Iterator>
+typename range<Iterator>::const_iterator range<Iterator>::end() const
+{
+    return last;
+}
+
+template <typename Iterator>
+bool range<Iterator>::empty() const
+{
+    return first == last;
+}
+
+} // namespace detail
+} // namespace network
+
+#endif // NETWORK_DETAIL_RANGE_IPP
@@ -0,0 +1,173 @@
+#ifndef NETWORK_DETAIL_REQUEST_TARGET_VIEW_IPP
+#define NETWORK_DETAIL_REQUEST_TARGET_VIEW_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+
+inline request_target_view::request_target_view(const string_view& input)
+    : target_form(no_form)
+{
+    parse_target(input);
+}
+
+//-----------------------------------------------------------------------------
+// Accessors
+//-----------------------------------------------------------------------------
+
+inline request_target_view::form_type request_target_view::form() const
+{
+    return target_form;
+}
+
+//-----------------------------------------------------------------------------
+// Parser
+//-----------------------------------------------------------------------------
+
+inline void request_target_view::parse_target(const string_view& input)
+{
+    // RFC 7230 Section 5.3
+    //
+    // request-target = origin-form
+    //                / absolute-form
+    //                / authority-form
+    //                / asterisk-form
+
+    if (input.empty())
+        return;
+
+    switch (input.front())
+    {
+    case token_slash:
+        // Most requests use origin-form, so it is checked first
+        if (parse_origin_form(input) == input.size())
+            target_form = origin_form;
+        break;
+
+    case token_asterisk:
+        // asterisk-form = "*"
+        if (input.size() == sizeof(token_asterisk))
+            target_form = asterisk_form;
+        break;
+
+    default:
+        // Both absolute-form and authority-form may start with
+        // scheme ":". Only absolute-form continues with "//", and otherwise
+        // authority-form is tried first, so ambiguous targets such as
+        // "localhost:80" are authority-form as used by CONNECT. Other
+        // absolute-URIs without an authority, such as "urn:a:b", are
+        // absolute-form.
+        {
+            const size_type processed = parse_scheme(input);
+            const string_view rest = input.substr(processed);
+            const bool has_scheme = (processed > 0) &&
+                !rest.empty() &&
+                (rest[0] == token_colon);
+            if (has_scheme &&
+                (rest.size() >= 3) &&
+                (rest[1] == token_slash) &&
+                (rest[2] == token_slash))
+            {
+                if (parse_absolute_form(input) == input.size())
+                    target_form = absolute_form;
+                break;
+            }
+
+            clear();
+            if (parse_authority_form(input) == input.size())
+            {
+                target_form = authority_form;
+            }
+            else if (has_scheme)
+            {
+                clear();
+                if (parse_absolute_form(input) == input.size())
+                    target_form = absolute_form;
+            }
+        }
+        break;
+    }
+
+    // Do not expose the components of a partial parse
+    if (target_form == no_form)
+        clear();
+}
+
+inline void request_target_view::clear()
+{
+    scheme_view = string_view();
+    userinfo_view = string_view();
+    host_view = string_view();
+    port_view = string_view();
+    authority_view = string_view();
+    path_view = string_view();
+    query_view = string_view();
+    fragment_view = string_view();
+}
+
+inline request_target_view::size_type
+request_target_view::parse_origin_form(const string_view& input)
+{
+    // RFC 7230 Section 5.3.1
+    //
+    // origin-form   = absolute-path [ "?" query ]
+    // absolute-path = 1*( "/" segment )
+
+    size_type current = parse_path_abempty(input);
+    if (current == 0)
+        return 0;
+    path_view = input.substr(0, current);
+
+    if ((current < input.size()) && (input[current] == token_question_mark))
+    {
+        current += sizeof(token_question_mark);
+        current += parse_query(input.substr(current));
+    }
+    return current;
+}
+
+inline request_target_view::size_type
+request_target_view::parse_absolute_form(const string_view& input)
+{
+    // RFC 7230 Section 5.3.2
+    //
+    // absolute-form = absolute-URI
+    //
+    // RFC 3986 Section 4.3
+    //
+    // absolute-URI  = scheme ":" hier-part [ "?" query ]
+
+    // The fragment delimiter cannot appear anywhere in a valid absolute-URI
+    if (input.find(token_number_sign) != string_view::npos)
+        return 0;
+    return parse(input);
+}
+
+inline request_target_view::size_type
+request_target_view::parse_authority_form(const string_view& input)
+{
+    // RFC 7230 Section 5.3.3
+    //
+    // authority-form = authority
+    //
+    // Only used by CONNECT, which requires both host and port.
+
+    const size_type processed = parse_authority(input);
+    if ((processed == 0) || host_view.empty() || port_view.empty())
+        return 0;
+    authority_view = input.substr(0, processed);
+    return processed;
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_REQUEST_TARGET_VIEW_IPP
@@ -0,0 +1,337 @@
+#ifndef NETWORK_DETAIL_ROUTER_IPP
+#define NETWORK_DETAIL_ROUTER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <network/detail/traits.hpp>
+
+namespace network
+{
+
+//-----------------------------------------------------------------------------
+// router::builder
+//-----------------------------------------------------------------------------
+
+template <typename T>
+router<T>::builder::entry::entry()
+    : parameter_child(npos),
+      wildcard_child(npos),
+      value(npos)
+{
+}
+
+template <typename T>
+router<T>::builder::builder()
+    : entries(1) // Root
+{
+}
+
+template <typename T>
+void router<T>::builder::insert(const string_view& pattern,
+                                const value_type& value)
+{
+    if (pattern.empty() || (pattern.front() != detail::traits<char>::alpha_slash))
+        throw std::invalid_argument("Route pattern must start with a slash");
+
+    size_type current = 0;
+    size_type parameters = 0;
+    bool has_wildcard = false;
+    const uri_view::segment_iterator end;
+    for (uri_view::segment_iterator it(pattern); it != end; ++it)
+    {
+        if (has_wildcard)
+            throw std::invalid_argument("Route wildcard must be the last segment");
+        if (!it->empty())
+        {
+            has_wildcard = (it->front() == detail::traits<char>::alpha_asterisk);
+            if (has_wildcard || (it->front() == detail::traits<char>::alpha_colon))
+            {
+                if (++parameters > max_parameters)
+                    throw std::invalid_argument("Too many route parameters");
+            }
+        }
+        current = insert_child(current, *it);
+    }
+    if (entries[current].value != npos)
+        throw std::invalid_argument("Duplicate route");
+    entries[current].value = values.size();
+    values.push_back(value);
+}
+
+template <typename T>
+typename router<T>::size_type
+router<T>::builder::insert_child(size_type parent, const string_view& segment)
+{
+    const bool is_parameter = !segment.empty() &&
+        (segment.front() == detail::traits<char>::alpha_colon);
+    const bool is_wildcard = !segment.empty() &&
+        (segment.front() == detail::traits<char>::alpha_asterisk);
+
+    if (!is_parameter && !is_wildcard)
+    {
+        const std::vector<size_type>& children = entries[parent].children;
+        for (size_type i = 0; i < children.size(); ++i)
+        {
+            if (entries[children[i]].label == segment)
+                return children[i];
+        }
+        const size_type result = entries.size();
+        entries.push_back(entry());
+        entries.back().label = std::string(segment.begin(), segment.end());
+        entries[parent].children.push_back(result);
+        return result;
+    }
+
+    const string_view name = segment.substr(1);
+    if (name.empty())
+        throw std::invalid_argument("Route parameter must be named");
+    const size_type existing = is_parameter
+        ? entries[parent].parameter_child
+        : entries[parent].wildcard_child;
+    if (existing != npos)
+    {
+        if (entries[existing].label != name)
+            throw std::invalid_argument("Conflicting route parameter names");
+        return existing;
+    }
+    const size_type result = entries.size();
+    entries.push_back(entry());
+    entries.back().label = std::string(name.begin(), name.end());
+    if (is_parameter)
+        entries[parent].parameter_child = result;
+    else
+        entries[parent].wildcard_child = result;
+    return result;
+}
+
+template <typename T>
+router<T>::builder::label_less::label_less(const std::vector<entry>& entries)
+    : entries(entries)
+{
+}
+
+template <typename T>
+bool router<T>::builder::label_less::operator()(size_type lhs, size_type rhs) const
+{
+    // Must agree with router::compare_label
+    const std::string& left = entries[lhs].label;
+    const std::string& right = entries[rhs].label;
+    if (left.size() != right.size())
+        return left.size() < right.size();
+    return left < right;
+}
+
+//-----------------------------------------------------------------------------
+// router::match_type
+//-----------------------------------------------------------------------------
+
+template <typename T>
+router<T>::match_type::match_type()
+    : result(0),
+      count(0)
+{
+}
+
+template <typename T>
+const typename router<T>::value_type *router<T>::match_type::value() const
+{
+    return result;
+}
+
+template <typename T>
+typename router<T>::size_type router<T>::match_type::size() const
+{
+    return count;
+}
+
+template <typename T>
+const typename router<T>::parameter_type&
+router<T>::match_type::operator[](size_type index) const
+{
+    return parameters[index];
+}
+
+template <typename T>
+typename router<T>::string_view
+router<T>::match_type::parameter(const string_view& name) const
+{
+    for (size_type i = 0; i < count; ++i)
+    {
+        if (parameters[i].first == name)
+            return parameters[i].second;
+    }
+    return string_view();
+}
+
+//-----------------------------------------------------------------------------
+// router
+//-----------------------------------------------------------------------------
+
+template <typename T>
+router<T>::router(const builder& input)
+    : values(input.values)
+{
+    if (input.entries.size() >= std::numeric_limits<index_type>::max())
+        throw std::length_error("Too many routes");
+
+    // Breadth-first flattening places the children of each node next to
+    // each other. The queue holds builder entries in output order.
+    std::vector<size_type> queue(1, 0);
+    nodes.reserve(input.entries.size());
+
+    for (size_type current = 0; current < queue.size(); ++current)
+    {
+        const typename builder::entry& source = input.entries[queue[current]];
+
+        std::vector<size_type> children = source.children;
+        std::sort(children.begin(), children.end(), typename builder::label_less(input.entries));
+
+        node target;
+        target.label_offset = append_label(source.label);
+        target.label_size = index_type(source.label.size());
+        target.first_child = index_type(queue.size());
+        target.child_count = index_type(children.size());
+        queue.insert(queue.end(), children.begin(), children.end());
+        target.parameter_child = npos;
+        if (source.parameter_child != builder::npos)
+        {
+            target.parameter_child = index_type(queue.size());
+            queue.push_back(source.parameter_child);
+        }
+        target.wildcard_child = npos;
+        if (source.wildcard_child != builder::npos)
+        {
+            target.wildcard_child = index_type(queue.size());
+            queue.push_back(source.wildcard_child);
+        }
+        target.value = (source.value == builder::npos)
+            ? npos
+            : index_type(source.value);
+        nodes.push_back(target);
+    }
+}
+
+template <typename T>
+bool router<T>::match(const string_view& path, match_type& result) const
+{
+    result.result = 0;
+    result.count = 0;
+    return match_node(0, uri_view::segment_iterator(path), path, result);
+}
+
+template <typename T>
+typename router<T>::size_type router<T>::size() const
+{
+    return values.size();
+}
+
+template <typename T>
+bool router<T>::match_node(index_type index,
+                           uri_view::segment_iterator it,
+                           const string_view& path,
+                           match_type& result) const
+{
+    const node& current = nodes[index];
+
+    if (it == uri_view::segment_iterator())
+    {
+        if (current.value == npos)
+            return false;
+        result.result = &values[current.value];
+        return true;
+    }
+
+    const string_view segment = *it;
+    ++it;
+
+    // Literal segment
+    const index_type child = find_child(current, segment);
+    if ((child != npos) && match_node(child, it, path, result))
+        return true;
+
+    // Parameter
+    if ((current.parameter_child != npos) && !segment.empty())
+    {
+        const size_type count = result.count;
+        result.parameters[count] = parameter_type(label(nodes[current.parameter_child]),
+                                                  segment);
+        result.count = count + 1;
+        if (match_node(current.parameter_child, it, path, result))
+            return true;
+        result.count = count;
+    }
+
+    // Wildcard
+    if (current.wildcard_child != npos)
+    {
+        const node& wildcard = nodes[current.wildcard_child];
+        const size_type offset = segment.data() - path.data();
+        result.parameters[result.count] = parameter_type(label(wildcard),
+                                                         path.substr(offset));
+        ++result.count;
+        result.result = &values[wildcard.value];
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+typename router<T>::index_type
+router<T>::find_child(const node& parent, const string_view& segment) const
+{
+    // Binary search among literal children sorted by compare_label
+    index_type low = parent.first_child;
+    index_type high = parent.first_child + parent.child_count;
+    while (low < high)
+    {
+        const index_type middle = low + (high - low) / 2;
+        const int compared = compare_label(nodes[middle], segment);
+        if (compared < 0)
+            low = middle + 1;
+        else if (compared > 0)
+            high = middle;
+        else
+            return middle;
+    }
+    return npos;
+}
+
+template <typename T>
+int router<T>::compare_label(const node& current, const string_view& segment) const
+{
+    // Order by length first so most mismatches avoid comparing characters
+    if (current.label_size != segment.size())
+        return (current.label_size < segment.size()) ? -1 : 1;
+    return std::char_traits<char>::compare(labels.data() + current.label_offset,
+                                           segment.data(),
+                                           segment.size());
+}
+
+template <typename T>
+typename router<T>::string_view router<T>::label(const node& current) const
+{
+    return string_view(labels.data() + current.label_offset, current.label_size);
+}
+
+template <typename T>
+typename router<T>::index_type router<T>::append_label(const std::string& label)
+{
+    const index_type result = index_type(labels.size());
+    labels += label;
+    return result;
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_ROUTER_IPP
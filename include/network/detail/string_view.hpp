@@ -0,0 +1,41 @@
+#ifndef NETWORK_DETAIL_STRING_VIEW_HPP
+#define NETWORK_DETAIL_STRING_VIEW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <network/config.hpp>
+#if defined(NETWORK_URI_USE_STD_STRING_VIEW)
+# include <string_view>
+#else
+# include <boost/utility/string_ref.hpp>
+#endif
+
+namespace network
+{
+namespace detail
+{
+
+// Selects the string view type configured in network/config.hpp
+
+template <typename CharT>
+struct basic_string_view
+{
+#if defined(NETWORK_URI_USE_STD_STRING_VIEW)
+    typedef std::basic_string_view<CharT> type;
+#else
+    typedef boost::basic_string_ref<CharT> type;
+#endif
+};
+
+} // namespace detail
+} // namespace network
+
+#endif // NETWORK_DETAIL_STRING_VIEW_HPP
@@ -11,7 +11,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <boost/config.hpp>
+#include <string>
+#include <network/config.hpp>
 
 namespace network
 {
@@ -24,53 +25,121 @@ class traits
 };
 
 //-----------------------------------------------------------------------------
-// char specialization
+// ascii_table
+//
+// Character classes of the ASCII range, shared by all character types.
 //-----------------------------------------------------------------------------
 
-template <>
-class traits<char>
+struct ascii_table
+{
+    typedef unsigned char class_type;
+
+    enum
+    {
+        alpha = 1 << 0,
+        digit = 1 << 1,
+        hexdigit = 1 << 2,
+        scheme = 1 << 3,
+        unreserved = 1 << 4,
+        subdelims = 1 << 5
+    };
+
+    // Table of 128 entries indexed by character value
+    static const class_type *classes() NETWORK_NOEXCEPT;
+};
+
+//-----------------------------------------------------------------------------
+// ascii_traits
+//
+// Character classification for character types whose encoding agrees with
+// ASCII in the range 0x00-0x7F.
+//-----------------------------------------------------------------------------
+
+template <typename CharT>
+class ascii_traits
 {
 public:
-    typedef char value_type;
+    typedef CharT value_type;
     typedef typename std::char_traits<value_type>::int_type int_type;
 
-    static bool is_digit(value_type value) BOOST_NOEXCEPT;
-    static bool is_alpha(value_type value) BOOST_NOEXCEPT;
-    static bool is_hexdigit(value_type value) BOOST_NOEXCEPT;
-    static int_type hex_to_int(value_type value) BOOST_NOEXCEPT;
-
-    BOOST_STATIC_CONSTANT(value_type, alpha_space = ' ');
-    BOOST_STATIC_CONSTANT(value_type, alpha_exclamation = '!');
-    BOOST_STATIC_CONSTANT(value_type, alpha_number_sign = '#');
-    BOOST_STATIC_CONSTANT(value_type, alpha_dollar = '$');
-    BOOST_STATIC_CONSTANT(value_type, alpha_percent = '%');
-    BOOST_STATIC_CONSTANT(value_type, alpha_ampersand = '&');
-    BOOST_STATIC_CONSTANT(value_type, alpha_apostrophe = '\'');
-    BOOST_STATIC_CONSTANT(value_type, alpha_parens_open = '(');
-    BOOST_STATIC_CONSTANT(value_type, alpha_parens_close = ')');
-    BOOST_STATIC_CONSTANT(value_type, alpha_asterisk = '*');
-    BOOST_STATIC_CONSTANT(value_type, alpha_plus = '+');
-    BOOST_STATIC_CONSTANT(value_type, alpha_comma = ',');
-    BOOST_STATIC_CONSTANT(value_type, alpha_minus = '-');
-    BOOST_STATIC_CONSTANT(value_type, alpha_dot = '.');
-    BOOST_STATIC_CONSTANT(value_type, alpha_slash = '/');
-    BOOST_STATIC_CONSTANT(value_type, alpha_0 = '0');
-    BOOST_STATIC_CONSTANT(value_type, alpha_colon = ':');
-    BOOST_STATIC_CONSTANT(value_type, alpha_semicolon = ';');
-    BOOST_STATIC_CONSTANT(value_type, alpha_equal = '=');
-    BOOST_STATIC_CONSTANT(value_type, alpha_question_mark = '?');
-    BOOST_STATIC_CONSTANT(value_type, alpha_at = '@');
-    BOOST_STATIC_CONSTANT(value_type, alpha_A = 'A');
-    BOOST_STATIC_CONSTANT(value_type, alpha_a = 'a');
-    BOOST_STATIC_CONSTANT(value_type, alpha_bracket_open = '[');
-    BOOST_STATIC_CONSTANT(value_type, alpha_bracket_close = ']');
-    BOOST_STATIC_CONSTANT(value_type, alpha_underscore = '_');
-    BOOST_STATIC_CONSTANT(value_type, alpha_tilde = '~');
+    static bool is_ascii(value_type value) NETWORK_NOEXCEPT;
+    // Returns ascii_table classes, or zero for non-ASCII characters
+    static ascii_table::class_type classify(value_type value) NETWORK_NOEXCEPT;
+    static bool is_digit(value_type value) NETWORK_NOEXCEPT;
+    static bool is_alpha(value_type value) NETWORK_NOEXCEPT;
+    static bool is_hexdigit(value_type value) NETWORK_NOEXCEPT;
+    static bool is_scheme(value_type value) NETWORK_NOEXCEPT;
+    static bool is_unreserved(value_type value) NETWORK_NOEXCEPT;
+    static bool is_subdelims(value_type value) NETWORK_NOEXCEPT;
+    static int_type hex_to_int(value_type value) NETWORK_NOEXCEPT;
+    static value_type to_lower(value_type value) NETWORK_NOEXCEPT;
+
+    static const value_type alpha_space = 0x20; // ' '
+    static const value_type alpha_exclamation = 0x21; // '!'
+    static const value_type alpha_number_sign = 0x23; // '#'
+    static const value_type alpha_dollar = 0x24; // '$'
+    static const value_type alpha_percent = 0x25; // '%'
+    static const value_type alpha_ampersand = 0x26; // '&'
+    static const value_type alpha_apostrophe = 0x27; // '\''
+    static const value_type alpha_parens_open = 0x28; // '('
+    static const value_type alpha_parens_close = 0x29; // ')'
+    static const value_type alpha_asterisk = 0x2A; // '*'
+    static const value_type alpha_plus = 0x2B; // '+'
+    static const value_type alpha_comma = 0x2C; // ','
+    static const value_type alpha_minus = 0x2D; // '-'
+    static const value_type alpha_dot = 0x2E; // '.'
+    static const value_type alpha_slash = 0x2F; // '/'
+    static const value_type alpha_0 = 0x30; // '0'
+    static const value_type alpha_colon = 0x3A; // ':'
+    static const value_type alpha_semicolon = 0x3B; // ';'
+    static const value_type alpha_equal = 0x3D; // '='
+    static const value_type alpha_question_mark = 0x3F; // '?'
+    static const value_type alpha_at = 0x40; // '@'
+    static const value_type alpha_A = 0x41; // 'A'
+    static const value_type alpha_a = 0x61; // 'a'
+    static const value_type alpha_n = 0x6E; // 'n'
+    static const value_type alpha_x = 0x78; // 'x'
+    static const value_type alpha_bracket_open = 0x5B; // '['
+    static const value_type alpha_bracket_close = 0x5D; // ']'
+    static const value_type alpha_underscore = 0x5F; // '_'
+    static const value_type alpha_tilde = 0x7E; // '~'
 
 private:
-    static bool is_hex_upper(value_type value) BOOST_NOEXCEPT;
-    static bool is_hex_lower(value_type value) BOOST_NOEXCEPT;
+    static bool is_hex_upper(value_type value) NETWORK_NOEXCEPT;
+    static bool is_hex_lower(value_type value) NETWORK_NOEXCEPT;
+};
+
+//-----------------------------------------------------------------------------
+// Specializations
+//-----------------------------------------------------------------------------
+
+template <>
+class traits<char> : public ascii_traits<char>
+{
+};
+
+// Wide characters are assumed to be UTF-16 or UTF-32
+template <>
+class traits<wchar_t> : public ascii_traits<wchar_t>
+{
+};
+
+template <>
+class traits<char16_t> : public ascii_traits<char16_t>
+{
+};
+
+template <>
+class traits<char32_t> : public ascii_traits<char32_t>
+{
+};
+
+#if defined(__cpp_char8_t)
+template <>
+class traits<char8_t> : public ascii_traits<char8_t>
+{
 };
+#endif
 
 } // namespace detail
 } // namespace network
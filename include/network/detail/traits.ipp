@@ -11,66 +11,127 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cassert>
+
 namespace network
 {
 namespace detail
 {
 
 //-----------------------------------------------------------------------------
-// char specialization
+// ascii_table
+//-----------------------------------------------------------------------------
+
+inline const ascii_table::class_type *ascii_table::classes() NETWORK_NOEXCEPT
+{
+    const class_type A = alpha;
+    const class_type D = digit;
+    const class_type H = hexdigit;
+    const class_type S = scheme;
+    const class_type U = unreserved;
+    const class_type X = subdelims;
+
+    static const class_type table[128] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, // 0x00
+        0, 0, 0, 0, 0, 0, 0, 0, // 0x08
+        0, 0, 0, 0, 0, 0, 0, 0, // 0x10
+        0, 0, 0, 0, 0, 0, 0, 0, // 0x18
+        0, X, 0, 0, X, 0, X, X, // 0x20
+        X, X, X, S|X, X, S|U, S|U, 0, // 0x28
+        D|H|S|U, D|H|S|U, D|H|S|U, D|H|S|U, D|H|S|U, D|H|S|U, D|H|S|U, D|H|S|U, // 0x30
+        D|H|S|U, D|H|S|U, 0, X, 0, X, 0, 0, // 0x38
+        0, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|S|U, // 0x40
+        A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, // 0x48
+        A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, // 0x50
+        A|S|U, A|S|U, A|S|U, 0, 0, 0, 0, U, // 0x58
+        0, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|H|S|U, A|S|U, // 0x60
+        A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, // 0x68
+        A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, A|S|U, // 0x70
+        A|S|U, A|S|U, A|S|U, 0, 0, 0, U, 0, // 0x78
+    };
+    return table;
+}
+
+//-----------------------------------------------------------------------------
+// ascii_traits
 //-----------------------------------------------------------------------------
 
-inline bool traits<char>::is_digit(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+bool ascii_traits<CharT>::is_ascii(value_type value) NETWORK_NOEXCEPT
+{
+    // Negative values of signed character types are not ASCII either
+    return (static_cast<unsigned long>(value) & ~0x7FUL) == 0;
+}
+
+template <typename CharT>
+ascii_table::class_type ascii_traits<CharT>::classify(value_type value) NETWORK_NOEXCEPT
+{
+    return is_ascii(value)
+        ? ascii_table::classes()[static_cast<unsigned int>(value)]
+        : 0;
+}
+
+template <typename CharT>
+bool ascii_traits<CharT>::is_digit(value_type value) NETWORK_NOEXCEPT
 {
     // RFC 2234 Section 6.1
     //
     // DIGIT =  %x30-39 ; 0-9
 
-    switch (value)
-    {
-    case 0x30: case 0x31: case 0x32: case 0x33:
-    case 0x34: case 0x35: case 0x36: case 0x37:
-    case 0x38: case 0x39:
-        return true;
-    default:
-        return false;
-    }
+    return (classify(value) & ascii_table::digit) != 0;
 }
 
-inline bool traits<char>::is_alpha(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+bool ascii_traits<CharT>::is_alpha(value_type value) NETWORK_NOEXCEPT
 {
     // RFC 2234 Section 6.1
     //
     // ALPHA = %x41-5A / %x61-7A  ; A-Z / a-z
 
-    switch (value)
-    {
-    case 0x41: case 0x42: case 0x43: // A-Z
-    case 0x44: case 0x45: case 0x46: case 0x47:
-    case 0x48: case 0x49: case 0x4A: case 0x4B:
-    case 0x4C: case 0x4D: case 0x4E: case 0x4F:
-    case 0x50: case 0x51: case 0x52: case 0x53:
-    case 0x54: case 0x55: case 0x56: case 0x57:
-    case 0x58: case 0x59: case 0x5A:
-    case 0x61: case 0x62: case 0x63: // a-z
-    case 0x64: case 0x65: case 0x66: case 0x67:
-    case 0x68: case 0x69: case 0x6A: case 0x6B:
-    case 0x6C: case 0x6D: case 0x6E: case 0x6F:
-    case 0x70: case 0x71: case 0x72: case 0x73:
-    case 0x74: case 0x75: case 0x76: case 0x77:
-    case 0x78: case 0x79: case 0x7A:
-        return true;
-    default:
-        return false;
-    }
+    return (classify(value) & ascii_table::alpha) != 0;
+}
+
+template <typename CharT>
+bool ascii_traits<CharT>::is_hexdigit(value_type value) NETWORK_NOEXCEPT
+{
+    return (classify(value) & ascii_table::hexdigit) != 0;
+}
+
+template <typename CharT>
+bool ascii_traits<CharT>::is_scheme(value_type value) NETWORK_NOEXCEPT
+{
+    // RFC 3986 Section 3.1
+    //
+    // Optional part of scheme.
+    //
+    // ALPHA / DIGIT / "+" / "-" / "."
+
+    return (classify(value) & ascii_table::scheme) != 0;
+}
+
+template <typename CharT>
+bool ascii_traits<CharT>::is_unreserved(value_type value) NETWORK_NOEXCEPT
+{
+    // RFC 3986 Section 2.3
+    //
+    // unreserved = ALPHA / DIGIT / "-" / "." / "_" / "~"
+
+    return (classify(value) & ascii_table::unreserved) != 0;
 }
 
-inline bool traits<char>::is_hexdigit(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+bool ascii_traits<CharT>::is_subdelims(value_type value) NETWORK_NOEXCEPT
 {
-    return is_digit(value) || is_hex_upper(value) || is_hex_lower(value);
+    // RFC 3986 Section 2.2
+    //
+    // sub-delims = "!" / "$" / "&" / "'" / "(" / ")" / "*" / "+" / "," / ";" / "="
+
+    return (classify(value) & ascii_table::subdelims) != 0;
 }
 
-inline bool traits<char>::is_hex_upper(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+bool ascii_traits<CharT>::is_hex_upper(value_type value) NETWORK_NOEXCEPT
 {
     switch (value)
     {
@@ -82,7 +143,8 @@ inline bool traits<char>::is_hex_upper(value_type value) BOOST_NOEXCEPT
     }
 }
 
-inline bool traits<char>::is_hex_lower(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+bool ascii_traits<CharT>::is_hex_lower(value_type value) NETWORK_NOEXCEPT
 {
     switch (value)
     {
@@ -94,8 +156,9 @@ inline bool traits<char>::is_hex_lower(value_type value) BOOST_NOEXCEPT
     }
 }
 
-inline typename traits<char>::int_type
-traits<char>::hex_to_int(value_type value) BOOST_NOEXCEPT
+template <typename CharT>
+typename ascii_traits<CharT>::int_type
+ascii_traits<CharT>::hex_to_int(value_type value) NETWORK_NOEXCEPT
 {
     if (is_digit(value))
         return value - alpha_0;
@@ -107,6 +170,26 @@ traits<char>::hex_to_int(value_type value) BOOST_NOEXCEPT
     return 0;
 }
 
+template <typename CharT>
+typename ascii_traits<CharT>::value_type
+ascii_traits<CharT>::to_lower(value_type value) NETWORK_NOEXCEPT
+{
+    // ASCII only, as used for case-insensitive URI components
+    switch (value)
+    {
+    case 0x41: case 0x42: case 0x43: // A-Z
+    case 0x44: case 0x45: case 0x46: case 0x47:
+    case 0x48: case 0x49: case 0x4A: case 0x4B:
+    case 0x4C: case 0x4D: case 0x4E: case 0x4F:
+    case 0x50: case 0x51: case 0x52: case 0x53:
+    case 0x54: case 0x55: case 0x56: case 0x57:
+    case 0x58: case 0x59: case 0x5A:
+        return value_type(value - alpha_A + alpha_a);
+    default:
+        return value;
+    }
+}
+
 } // namespace detail
 } // namespace network
 
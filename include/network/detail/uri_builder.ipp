@@ -0,0 +1,409 @@
+#ifndef NETWORK_DETAIL_URI_BUILDER_IPP
+#define NETWORK_DETAIL_URI_BUILDER_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <stdexcept>
+#include <network/detail/traits.hpp>
+
+namespace network
+{
+namespace detail
+{
+
+// Exposes the IPv6address production of uri_view
+
+class ipv6address_parser : private uri_view
+{
+public:
+    static bool is_valid(const string_view& input)
+    {
+        ipv6address_parser parser;
+        return !input.empty() && (parser.parse_ipv6address(input) == input.size());
+    }
+};
+
+} // namespace detail
+
+inline uri_builder::uri_builder()
+    : authority_enabled(false)
+{
+}
+
+inline uri_builder::uri_builder(const uri_view& other)
+    : scheme_view(other.scheme()),
+      userinfo_view(other.userinfo()),
+      host_view(other.host()),
+      port_view(other.port()),
+      path_view(other.path()),
+      query_view(other.query()),
+      fragment_view(other.fragment()),
+      authority_enabled(other.has_authority())
+{
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline uri_builder& uri_builder::scheme(const string_view& input)
+{
+    // RFC 3986 Section 3.1
+    //
+    // scheme = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
+
+    if (!input.empty())
+    {
+        if (!detail::traits<value_type>::is_alpha(input.front()))
+            throw std::invalid_argument("Invalid scheme");
+        for (size_type i = 1; i < input.size(); ++i)
+        {
+            if (!detail::traits<value_type>::is_scheme(input[i]))
+                throw std::invalid_argument("Invalid scheme");
+        }
+    }
+    scheme_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::authority(bool enable)
+{
+    authority_enabled = enable;
+    return *this;
+}
+
+inline uri_builder& uri_builder::userinfo(const string_view& input)
+{
+    userinfo_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::host(const string_view& input)
+{
+    if (input.find(detail::traits<value_type>::alpha_colon) != string_view::npos)
+    {
+        // RFC 3986 Section 3.2.2
+        //
+        // Zone identifiers and IPvFuture are not supported.
+        if (!detail::ipv6address_parser::is_valid(input))
+            throw std::invalid_argument("Invalid IPv6 address");
+    }
+    host_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::port(const string_view& input)
+{
+    // RFC 3986 Section 3.2.3
+    //
+    // port = *DIGIT
+
+    for (size_type i = 0; i < input.size(); ++i)
+    {
+        if (!detail::traits<value_type>::is_digit(input[i]))
+            throw std::invalid_argument("Invalid port");
+    }
+    port_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::path(const string_view& input)
+{
+    path_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::query(const string_view& input)
+{
+    query_view = input;
+    return *this;
+}
+
+inline uri_builder& uri_builder::fragment(const string_view& input)
+{
+    fragment_view = input;
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// Serialization
+//-----------------------------------------------------------------------------
+
+inline uri_builder::size_type uri_builder::size() const
+{
+    // Must agree with write()
+
+    size_type result = 0;
+    if (!scheme_view.empty())
+    {
+        result += scheme_view.size() + sizeof(detail::traits<value_type>::alpha_colon);
+    }
+    if (has_authority())
+    {
+        result += 2 * sizeof(detail::traits<value_type>::alpha_slash);
+        if (!userinfo_view.empty())
+        {
+            result += encoded_size(userinfo_view, &uri_builder::is_userinfo);
+            result += sizeof(detail::traits<value_type>::alpha_at);
+        }
+        if (is_ipv6_host())
+        {
+            result += host_view.size() + 2;
+        }
+        else
+        {
+            result += encoded_size(host_view, &uri_builder::is_regname);
+        }
+        if (!port_view.empty())
+        {
+            result += sizeof(detail::traits<value_type>::alpha_colon) + port_view.size();
+        }
+    }
+    if (needs_path_slash())
+    {
+        result += sizeof(detail::traits<value_type>::alpha_slash);
+    }
+    else if (needs_path_dot())
+    {
+        result += sizeof(detail::traits<value_type>::alpha_slash) +
+            sizeof(detail::traits<value_type>::alpha_dot);
+    }
+    result += encoded_size(path_view, &uri_builder::is_path);
+    if (!query_view.empty())
+    {
+        result += sizeof(detail::traits<value_type>::alpha_question_mark);
+        result += encoded_size(query_view, &uri_builder::is_query);
+    }
+    if (!fragment_view.empty())
+    {
+        result += sizeof(detail::traits<value_type>::alpha_number_sign);
+        result += encoded_size(fragment_view, &uri_builder::is_query);
+    }
+    return result;
+}
+
+inline uri_builder::value_type *uri_builder::write(value_type *output) const
+{
+    // RFC 3986 Section 5.3
+
+    if (!scheme_view.empty())
+    {
+        output = copy(scheme_view, output);
+        *output++ = detail::traits<value_type>::alpha_colon;
+    }
+    if (has_authority())
+    {
+        *output++ = detail::traits<value_type>::alpha_slash;
+        *output++ = detail::traits<value_type>::alpha_slash;
+        if (!userinfo_view.empty())
+        {
+            output = encode(userinfo_view, &uri_builder::is_userinfo, output);
+            *output++ = detail::traits<value_type>::alpha_at;
+        }
+        if (is_ipv6_host())
+        {
+            *output++ = detail::traits<value_type>::alpha_bracket_open;
+            output = copy(host_view, output);
+            *output++ = detail::traits<value_type>::alpha_bracket_close;
+        }
+        else
+        {
+            output = encode(host_view, &uri_builder::is_regname, output);
+        }
+        if (!port_view.empty())
+        {
+            *output++ = detail::traits<value_type>::alpha_colon;
+            output = copy(port_view, output);
+        }
+    }
+    if (needs_path_slash())
+    {
+        *output++ = detail::traits<value_type>::alpha_slash;
+    }
+    else if (needs_path_dot())
+    {
+        *output++ = detail::traits<value_type>::alpha_slash;
+        *output++ = detail::traits<value_type>::alpha_dot;
+    }
+    output = encode(path_view, &uri_builder::is_path, output);
+    if (!query_view.empty())
+    {
+        *output++ = detail::traits<value_type>::alpha_question_mark;
+        output = encode(query_view, &uri_builder::is_query, output);
+    }
+    if (!fragment_view.empty())
+    {
+        *output++ = detail::traits<value_type>::alpha_number_sign;
+        output = encode(fragment_view, &uri_builder::is_query, output);
+    }
+    return output;
+}
+
+//-----------------------------------------------------------------------------
+// Implementation
+//-----------------------------------------------------------------------------
+
+inline uri_builder::size_type uri_builder::encoded_size(const string_view& input,
+                                                       predicate_type predicate)
+{
+    // Must agree with encode()
+
+    size_type result = 0;
+    size_type current = 0;
+    while (current < input.size())
+    {
+        if (is_pct_encoded(input, current))
+        {
+            result += 3;
+            current += 3;
+        }
+        else
+        {
+            result += predicate(input[current]) ? 1 : 3;
+            ++current;
+        }
+    }
+    return result;
+}
+
+inline uri_builder::value_type *uri_builder::encode(const string_view& input,
+                                                    predicate_type predicate,
+                                                    value_type *output)
+{
+    // RFC 3986 Section 2.1
+    //
+    // pct-encoded = "%" HEXDIG HEXDIG
+
+    static const value_type hexdigits[] = "0123456789ABCDEF";
+
+    size_type current = 0;
+    while (current < input.size())
+    {
+        if (is_pct_encoded(input, current))
+        {
+            *output++ = input[current++];
+            *output++ = input[current++];
+            *output++ = input[current++];
+        }
+        else
+        {
+            const value_type value = input[current++];
+            if (predicate(value))
+            {
+                *output++ = value;
+            }
+            else
+            {
+                const unsigned char octet = static_cast<unsigned char>(value);
+                *output++ = detail::traits<value_type>::alpha_percent;
+                *output++ = hexdigits[octet >> 4];
+                *output++ = hexdigits[octet & 0x0F];
+            }
+        }
+    }
+    return output;
+}
+
+inline uri_builder::value_type *uri_builder::copy(const string_view& input,
+                                                  value_type *output)
+{
+    return std::copy(input.begin(), input.end(), output);
+}
+
+inline bool uri_builder::is_pct_encoded(const string_view& input, size_type position)
+{
+    return (input[position] == detail::traits<value_type>::alpha_percent) &&
+        (position + 2 < input.size()) &&
+        detail::traits<value_type>::is_hexdigit(input[position + 1]) &&
+        detail::traits<value_type>::is_hexdigit(input[position + 2]);
+}
+
+inline bool uri_builder::is_userinfo(value_type value)
+{
+    // userinfo = *( unreserved / pct-encoded / sub-delims / ":" )
+
+    return detail::traits<value_type>::is_unreserved(value) ||
+        detail::traits<value_type>::is_subdelims(value) ||
+        (value == detail::traits<value_type>::alpha_colon);
+}
+
+inline bool uri_builder::is_regname(value_type value)
+{
+    // reg-name = *( unreserved / pct-encoded / sub-delims )
+
+    return detail::traits<value_type>::is_unreserved(value) ||
+        detail::traits<value_type>::is_subdelims(value);
+}
+
+inline bool uri_builder::is_path(value_type value)
+{
+    // pchar / "/"
+
+    switch (value)
+    {
+    case detail::traits<value_type>::alpha_colon:
+    case detail::traits<value_type>::alpha_at:
+    case detail::traits<value_type>::alpha_slash:
+        return true;
+    default:
+        return is_regname(value);
+    }
+}
+
+inline bool uri_builder::is_query(value_type value)
+{
+    // query = *( pchar / "/" / "?" )
+
+    return is_path(value) || (value == detail::traits<value_type>::alpha_question_mark);
+}
+
+inline bool uri_builder::has_authority() const
+{
+    return authority_enabled ||
+        !host_view.empty() ||
+        !userinfo_view.empty() ||
+        !port_view.empty();
+}
+
+inline bool uri_builder::is_ipv6_host() const
+{
+    return host_view.find(detail::traits<value_type>::alpha_colon) != string_view::npos;
+}
+
+inline bool uri_builder::needs_path_slash() const
+{
+    // RFC 3986 Section 3.3
+    //
+    // A path following an authority must be empty or start with "/", so
+    // "/" is written in front of a rootless path
+
+    return has_authority() &&
+        !path_view.empty() &&
+        (path_view.front() != detail::traits<value_type>::alpha_slash);
+}
+
+inline bool uri_builder::needs_path_dot() const
+{
+    // RFC 3986 Section 3.3
+    //
+    // Without an authority the path cannot start with "//", so "/." is
+    // written in front of it. Dot-segment removal yields the same path.
+
+    return !has_authority() &&
+        (path_view.size() >= 2) &&
+        (path_view[0] == detail::traits<value_type>::alpha_slash) &&
+        (path_view[1] == detail::traits<value_type>::alpha_slash);
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_URI_BUILDER_IPP
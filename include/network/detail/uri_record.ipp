@@ -0,0 +1,75 @@
+#ifndef NETWORK_DETAIL_URI_RECORD_IPP
+#define NETWORK_DETAIL_URI_RECORD_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <limits>
+#include <stdexcept>
+
+namespace network
+{
+
+inline uri_record::uri_record()
+    : scheme_id(intern_pool::npos),
+      host_id(intern_pool::npos),
+      path_offset(0),
+      path_size(0),
+      query_offset(0),
+      query_size(0)
+{
+}
+
+inline uri_record::uri_record(intern_pool& pool,
+                              const uri_view& uri,
+                              const string_view& buffer)
+    : scheme_id(uri.scheme().empty() ? intern_pool::npos : pool.insert(uri.scheme())),
+      host_id(uri.host().empty() ? intern_pool::npos : pool.insert(uri.host())),
+      path_offset(offset_of(uri.path(), buffer)),
+      path_size(offset_type(uri.path().size())),
+      query_offset(offset_of(uri.query(), buffer)),
+      query_size(offset_type(uri.query().size()))
+{
+}
+
+inline uri_record::id_type uri_record::scheme() const
+{
+    return scheme_id;
+}
+
+inline uri_record::id_type uri_record::host() const
+{
+    return host_id;
+}
+
+inline uri_record::string_view uri_record::path(const string_view& buffer) const
+{
+    return buffer.substr(path_offset, path_size);
+}
+
+inline uri_record::string_view uri_record::query(const string_view& buffer) const
+{
+    return buffer.substr(query_offset, query_size);
+}
+
+inline uri_record::offset_type uri_record::offset_of(const string_view& component,
+                                                     const string_view& buffer)
+{
+    if (component.empty())
+        return 0;
+    const std::size_t result = component.data() - buffer.data();
+    if (result + component.size() > std::numeric_limits<offset_type>::max())
+        throw std::length_error("URI record offset exceeds 32 bits");
+    return offset_type(result);
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_URI_RECORD_IPP
@@ -0,0 +1,201 @@
+#ifndef NETWORK_DETAIL_URI_VALIDATOR_IPP
+#define NETWORK_DETAIL_URI_VALIDATOR_IPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace network
+{
+
+template <typename CharT, typename Instrument>
+basic_uri_validator<CharT, Instrument>::basic_uri_validator()
+{
+}
+
+template <typename CharT, typename Instrument>
+void basic_uri_validator<CharT, Instrument>::allow_scheme(const string_view& scheme)
+{
+    schemes.push_back(to_lower(scheme));
+}
+
+template <typename CharT, typename Instrument>
+void basic_uri_validator<CharT, Instrument>::allow_host(const string_view& host)
+{
+    hosts.push_back(to_lower(host));
+}
+
+//-----------------------------------------------------------------------------
+// Validation
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::validate(const string_view& input,
+                                                      mask_type *mask)
+{
+    const bool valid = check(input);
+    if (mask)
+    {
+        *mask = valid ? components() : 0;
+    }
+    return valid;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_validator<CharT, Instrument>::size_type
+basic_uri_validator<CharT, Instrument>::validate(const string_view *inputs,
+                                                 size_type count,
+                                                 word_type *bitmap,
+                                                 mask_type *masks)
+{
+    const size_type word_bits = 64;
+    size_type result = 0;
+
+    for (size_type first = 0; first < count; first += word_bits)
+    {
+        // Bits are collected locally so each bitmap word is stored once
+        const size_type last = std::min(count, first + word_bits);
+        word_type word = 0;
+        for (size_type i = first; i < last; ++i)
+        {
+            const bool valid = check(inputs[i]);
+            if (masks)
+            {
+                masks[i] = valid ? components() : 0;
+            }
+            word |= word_type(valid) << (i - first);
+            result += valid;
+        }
+        bitmap[first / word_bits] = word;
+    }
+    return result;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_validator<CharT, Instrument>::size_type
+basic_uri_validator<CharT, Instrument>::bitmap_size(size_type count)
+{
+    return (count + 63) / 64;
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::check(const string_view& input)
+{
+    clear();
+
+    // parse_scheme() requires non-empty input
+    if (input.empty())
+        return false;
+
+    if (!schemes.empty())
+    {
+        // Reject unwanted schemes before parsing the remainder
+        const size_type processed = this->parse_scheme(input);
+        if ((processed == 0) ||
+            (processed == input.size()) ||
+            (input[processed] != CharT(super::token_colon)) ||
+            !is_allowed_scheme(input.substr(0, processed)))
+        {
+            return false;
+        }
+    }
+
+    if (this->parse(input) != input.size())
+        return false;
+
+    return hosts.empty() || is_allowed_host(this->host_view);
+}
+
+template <typename CharT, typename Instrument>
+void basic_uri_validator<CharT, Instrument>::clear()
+{
+    this->scheme_view = string_view();
+    this->userinfo_view = string_view();
+    this->host_view = string_view();
+    this->port_view = string_view();
+    this->authority_view = string_view();
+    this->path_view = string_view();
+    this->query_view = string_view();
+    this->fragment_view = string_view();
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_validator<CharT, Instrument>::mask_type
+basic_uri_validator<CharT, Instrument>::components() const
+{
+    return mask_type((this->scheme_view.empty() ? 0 : scheme_component) |
+                     (this->userinfo_view.empty() ? 0 : userinfo_component) |
+                     (this->host_view.empty() ? 0 : host_component) |
+                     (this->port_view.empty() ? 0 : port_component) |
+                     (this->authority_view.empty() ? 0 : authority_component) |
+                     (this->path_view.empty() ? 0 : path_component) |
+                     (this->query_view.empty() ? 0 : query_component) |
+                     (this->fragment_view.empty() ? 0 : fragment_component));
+}
+
+//-----------------------------------------------------------------------------
+// Matching
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::is_allowed_scheme(const string_view& scheme) const
+{
+    return is_allowed(schemes, scheme);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::is_allowed_host(const string_view& host) const
+{
+    return is_allowed(hosts, host);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::is_allowed(const std::vector<string_type>& allowed,
+                                                        const string_view& input)
+{
+    for (typename std::vector<string_type>::const_iterator it = allowed.begin();
+         it != allowed.end();
+         ++it)
+    {
+        if (equal_lowered(*it, input))
+            return true;
+    }
+    return false;
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_validator<CharT, Instrument>::equal_lowered(const string_type& lowered,
+                                                           const string_view& input)
+{
+    if (lowered.size() != input.size())
+        return false;
+
+    for (size_type i = 0; i < input.size(); ++i)
+    {
+        if (lowered[i] != detail::traits<CharT>::to_lower(input[i]))
+            return false;
+    }
+    return true;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_validator<CharT, Instrument>::string_type
+basic_uri_validator<CharT, Instrument>::to_lower(const string_view& input)
+{
+    string_type result(input.begin(), input.end());
+    for (typename string_type::iterator it = result.begin(); it != result.end(); ++it)
+    {
+        *it = detail::traits<CharT>::to_lower(*it);
+    }
+    return result;
+}
+
+} // namespace network
+
+#endif // NETWORK_DETAIL_URI_VALIDATOR_IPP
@@ -16,103 +16,184 @@
 namespace network
 {
 
-inline uri_view::uri_view(const string_view& input)
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::basic_uri_view()
 {
-    parse(input);
+}
+
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::basic_uri_view(const string_view& input)
+{
+    if (record(instrument::uri, parse(input)) < input.size())
+    {
+        reject(instrument::trailing_input);
+    }
 }
 
 //-----------------------------------------------------------------------------
 // Accessors
 //-----------------------------------------------------------------------------
 
-inline const uri_view::string_view& uri_view::scheme() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::scheme() const
 {
     return scheme_view;
 }
 
-inline const uri_view::string_view& uri_view::userinfo() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::userinfo() const
 {
     return userinfo_view;
 }
 
-inline const uri_view::string_view& uri_view::host() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::host() const
 {
     return host_view;
 }
 
-inline const uri_view::string_view& uri_view::port() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::port() const
 {
     return port_view;
 }
 
-inline const uri_view::string_view& uri_view::authority() const
+template <typename CharT, typename Instrument>
+std::uint16_t basic_uri_view<CharT, Instrument>::port_number() const
+{
+    std::uint16_t result = 0;
+    return port_number(result) ? result : 0;
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::port_number(std::uint16_t& output) const
+{
+    if (port_view.empty())
+        return false;
+
+    // The port only contains digits, as ensured by parse_port
+    std::uint32_t result = 0;
+    for (typename string_view::const_iterator it = port_view.begin(); it != port_view.end(); ++it)
+    {
+        result = result * 10 + (*it - detail::traits<CharT>::alpha_0);
+        if (result > 0xFFFF)
+            return false;
+    }
+    output = std::uint16_t(result);
+    return true;
+}
+
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::authority() const
 {
     return authority_view;
 }
 
-inline const uri_view::string_view& uri_view::path() const
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::has_authority() const
+{
+    // The view only refers to the input if "//" was parsed
+    return authority_view.data() != 0;
+}
+
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::path() const
 {
     return path_view;
 }
 
-inline const uri_view::string_view& uri_view::query() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::query() const
 {
     return query_view;
 }
 
-inline const uri_view::string_view& uri_view::fragment() const
+template <typename CharT, typename Instrument>
+const typename basic_uri_view<CharT, Instrument>::string_view&
+basic_uri_view<CharT, Instrument>::fragment() const
 {
     return fragment_view;
 }
 
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::segment_range
+basic_uri_view<CharT, Instrument>::path_segments() const
+{
+    return segment_range(segment_iterator(path_view), segment_iterator());
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::query_range
+basic_uri_view<CharT, Instrument>::query_params() const
+{
+    return query_range(query_iterator(query_view), query_iterator());
+}
+
 //-----------------------------------------------------------------------------
 // Parser
 //-----------------------------------------------------------------------------
 
-inline void uri_view::parse(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse(string_view input)
 {
     // RFC 3986 Section 3
     //
     // URI = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+    //
+    // Returns the number of characters processed.
+
+    const size_type size = input.size();
 
     if (input.empty())
-        return;
+        return 0;
 
-    size_type processed = parse_scheme(input);
+    size_type processed = record(instrument::scheme, parse_scheme(input));
     input.remove_prefix(processed);
 
+    if (processed == 0)
+    {
+        reject(instrument::missing_scheme);
+        return 0;
+    }
     if (input.empty() || (input.front() != token_colon))
-        return; // FIXME: Report error
-    input.remove_prefix(sizeof(token_colon));
+    {
+        reject(instrument::missing_colon);
+        scheme_view = string_view();
+        return 0;
+    }
+    input.remove_prefix(1);
 
-    processed = parse_hier_part(input);
-    if (processed == 0)
-        return;
+    // Zero is either path-empty or an invalid hier-part, both of which
+    // leave the input untouched
+    processed = record(instrument::hier_part, parse_hier_part(input));
     input.remove_prefix(processed);
-    if (input.empty())
-        return;
 
-    if (input.front() == token_question_mark)
+    if (!input.empty() && (input.front() == token_question_mark))
     {
         input.remove_prefix(1);
-        processed = parse_query(input);
-        if (processed == 0)
-            return;
-        if (input.empty())
-            return;
+        processed = record(instrument::query, parse_query(input));
+        input.remove_prefix(processed);
     }
-    if (input.front() == token_number_sign)
+    if (!input.empty() && (input.front() == token_number_sign))
     {
         input.remove_prefix(1);
-        processed = parse_fragment(input);
-        if (processed == 0)
-            return;
-        if (input.empty())
-            return;
+        processed = record(instrument::fragment, parse_fragment(input));
+        input.remove_prefix(processed);
     }
+    return size - input.size();
 }
 
-inline uri_view::size_type uri_view::parse_scheme(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_scheme(const string_view& input)
 {
     // RFC 3986 Section 3.1
     //
@@ -137,7 +218,9 @@ inline uri_view::size_type uri_view::parse_scheme(const string_view& input)
     return current;
 }
 
-inline uri_view::size_type uri_view::parse_hier_part(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_hier_part(const string_view& input)
 {
     // RFC 3986 Section 3
     //
@@ -146,82 +229,122 @@ inline uri_view::size_type uri_view::parse_hier_part(const string_view& input)
     //           / path-rootless
     //           / path-empty
 
-    size_type current = 0;
-    if (input[current] == token_slash)
+    size_type processed = 0;
+    if ((input.size() >= 2) &&
+        (input[0] == token_slash) &&
+        (input[1] == token_slash))
     {
-        ++current;
-        if (input[current] == token_slash)
-        {
-            ++current;
-            size_type processed = parse_authority(input.substr(current));
-            if (processed == 0)
-                return 0;
-            authority_view = input.substr(current, processed);
-            current += processed;
+        size_type current = 2;
+        // An empty authority is valid, and an invalid authority leaves
+        // the remainder to path-abempty, which rejects it
+        processed = record(instrument::authority, parse_authority(input.substr(current)));
+        authority_view = input.substr(current, processed);
+        current += processed;
 
-            processed = parse_path_abempty(input.substr(current));
-            if (processed == 0)
-                return current;
-            path_view = input.substr(current, processed);
-            current += processed;
-            return current;
-        }
-        else
-        {
-            assert(false); // Not implemented yet
-        }
+        processed = record(instrument::path_abempty, parse_path_abempty(input.substr(current)));
+        path_view = input.substr(current, processed);
+        current += processed;
+        return current;
     }
-    return 0;
+
+    processed = record(instrument::path_absolute, parse_path_absolute(input));
+    if (processed == 0)
+    {
+        processed = record(instrument::path_rootless, parse_path_rootless(input));
+    }
+    path_view = input.substr(0, processed);
+    return processed;
 }
 
-inline uri_view::size_type uri_view::parse_authority(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_authority(string_view input)
 {
     // RFC 3986 Section 3.2
     //
     // authority = [ userinfo "@" ] host [ ":" port ]
 
-    size_type processed = parse_userinfo(input);
-    size_type total = processed;
-    if (input[processed] == token_at)
+    size_type current = 0;
+    size_type processed = record(instrument::userinfo, parse_userinfo(input));
+    string_view userinfo;
+    if ((processed < input.size()) && (input[processed] == token_at))
     {
-        userinfo_view = input.substr(processed);
-        input.remove_prefix(processed + sizeof(token_at));
+        userinfo = input.substr(0, processed);
+        current = processed + 1;
     }
 
-    processed = parse_host(input);
-    if (processed == 0)
+    processed = record(instrument::host, parse_host(input.substr(current)));
+    if ((processed == 0) &&
+        (current < input.size()) &&
+        (input[current] == token_bracket_open))
+    {
+        // Only an invalid IP-literal fails, as the reg-name may be empty
+        reject(instrument::invalid_authority);
         return 0;
-    total += processed;
+    }
+    current += processed;
+    userinfo_view = userinfo;
 
-    if (input[processed] == token_colon)
+    if ((current < input.size()) && (input[current] == token_colon))
     {
-        processed = parse_port(input.substr(processed + sizeof(token_colon)));
-        if (processed > 0)
-            total += processed + sizeof(token_colon);
+        // The port may be empty
+        ++current;
+        current += record(instrument::port, parse_port(input.substr(current)));
     }
-    return total;
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_userinfo(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_userinfo(string_view input)
 {
     // RFC 3986 Section 3.2.1
     //
     // userinfo = *( unreserved / pct-encoded / sub-delims / ":" )
+    //
+    // Only a userinfo followed by "@" is used, so invalid percent-encodings
+    // are reported by the host instead.
 
-    return 0; // FIXME
+    size_type current = 0;
+    while (current < input.size())
+    {
+        size_type processed = 0;
+        if (input[current] == token_percent)
+        {
+            processed = record(instrument::pct_encoded, parse_pct_encoded(input.substr(current)));
+        }
+        else if ((input[current] == token_colon) ||
+                 is_unreserved_token(input[current]) ||
+                 is_subdelims_token(input[current]))
+        {
+            processed = 1;
+        }
+        if (processed == 0)
+            break;
+        current += processed;
+    }
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_host(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_host(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // host = IP-literal / IPv4address / reg-name
+    //
+    // The reg-name may be empty, in which case zero is returned and the
+    // host is empty.
+
+    if (input.empty())
+        return 0;
 
     size_type processed = 0;
 
     if (input[0] == token_bracket_open)
     {
-        processed = parse_ipliteral(input);
+        processed = record(instrument::ip_literal, parse_ipliteral(input));
         if (processed == 0)
             return 0;
         // Skip brackets
@@ -229,12 +352,13 @@ inline uri_view::size_type uri_view::parse_host(string_view input)
     }
     else
     {
-        processed = parse_ipv4address(input);
-        if (processed == 0)
+        // RFC 3986 Section 3.2.2 selects IPv4address only if it matches the
+        // whole host. IPv4address characters are also reg-name characters,
+        // so the reg-name continues where the IPv4address prefix ended.
+        processed = record(instrument::ipv4address, parse_ipv4address(input));
+        if (processed < input.size())
         {
-            processed = parse_regname(input);
-            if (processed == 0)
-                return 0;
+            processed += record(instrument::reg_name, parse_regname(input.substr(processed)));
         }
         host_view = input.substr(0, processed);
     }
@@ -242,68 +366,64 @@ inline uri_view::size_type uri_view::parse_host(string_view input)
     return processed;
 }
 
-inline uri_view::size_type uri_view::parse_ipliteral(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipliteral(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // IP-literal = "[" ( IPv6address / IPvFuture  ) "]"
 
-    string_view::const_iterator current = input.begin();
-    if (*current != token_bracket_open)
+    if (input.empty() || (input[0] != token_bracket_open))
         return 0;
-    ++current;
+    size_type current = 1;
 
-    size_type processed = parse_ipv6address(&*current);
+    size_type processed = record(instrument::ipv6address, parse_ipv6address(input.substr(current)));
     if (processed == 0)
     {
         // FIXME: IPvFuture
+        reject(instrument::invalid_ip_literal);
         return 0;
     }
     current += processed;
-    if (*current != token_bracket_close)
+    if ((current >= input.size()) || (input[current] != token_bracket_close))
+    {
+        reject(instrument::invalid_ip_literal);
         return 0;
+    }
     ++current;
 
-    return std::distance(input.begin(), current);
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_ipv4address(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv4address(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // IPv4address = dec-octet "." dec-octet "." dec-octet "." dec-octet
 
-    // First octet
-    size_type processed = parse_dec_octet(input);
-    size_type total = processed;
-    if ((processed == 0) || (input[total] != token_dot))
-        return 0;
-    total += sizeof(token_dot);
-
-    // Second octet
-    processed = parse_dec_octet(input.substr(total));
-    total += processed;
-    if ((processed == 0) || (input[total] != token_dot))
-        return 0;
-    total += sizeof(token_dot);
-
-    // Third octet
-    processed = parse_dec_octet(input.substr(total));
-    total += processed;
-    if ((processed == 0) || (input[total] != token_dot))
-        return 0;
-    total += sizeof(token_dot);
-
-    // Fourth octet
-    processed = parse_dec_octet(input.substr(total));
-    if (processed == 0)
-        return 0;
-    total += processed;
-
+    size_type total = 0;
+    for (int octet = 0; octet < 4; ++octet)
+    {
+        if (octet > 0)
+        {
+            if ((total >= input.size()) || (input[total] != token_dot))
+                return 0;
+            ++total;
+        }
+        const size_type processed = record(instrument::dec_octet, parse_dec_octet(input.substr(total)));
+        if (processed == 0)
+            return 0;
+        total += processed;
+    }
     return total;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address(const string_view& input)
 {
     // RFC 3986 Section 3.2.2
     //
@@ -317,115 +437,79 @@ inline uri_view::size_type uri_view::parse_ipv6address(const string_view& input)
     //             / [ *5( h16 ":" ) h16 ] "::"              h16
     //             / [ *6( h16 ":" ) h16 ] "::"
 
-    size_type processed = parse_ipv6address_1(input);
+    size_type processed = record(instrument::ipv6address_1, parse_ipv6address_1(input));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_2(input);
+    processed = record(instrument::ipv6address_2, parse_ipv6address_2(input));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_3(input, 1, 4);
+    processed = record(instrument::ipv6address_3, parse_ipv6address_3(input, 1, 4));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_3(input, 2, 3);
+    processed = record(instrument::ipv6address_3, parse_ipv6address_3(input, 2, 3));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_3(input, 3, 2);
+    processed = record(instrument::ipv6address_3, parse_ipv6address_3(input, 3, 2));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_3(input, 4, 1);
+    processed = record(instrument::ipv6address_3, parse_ipv6address_3(input, 4, 1));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_3(input, 5, 0);
+    processed = record(instrument::ipv6address_3, parse_ipv6address_3(input, 5, 0));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_4(input);
+    processed = record(instrument::ipv6address_4, parse_ipv6address_4(input));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_5(input);
+    processed = record(instrument::ipv6address_5, parse_ipv6address_5(input));
     if (processed > 0)
         return processed;
 
     return 0;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_1(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_1(const string_view& input)
 {
     // See parse_ipv6address
     //
     // 6( h16 ":" ) ls32
 
-    string_view::const_iterator current = input.begin();
-
-    size_type processed = 0;
-    for (size_type after = 0; after < 6; ++after)
-    {
-        processed = parse_ipv6address_h16(&*current);
-        if (processed == 0)
-            return 0;
-        current += processed;
-        if (current == input.end() || (*current != token_colon))
-            return 0;
-        ++current;
-        if (current == input.end())
-            return 0;
-    }
+    size_type current = parse_ipv6address_pieces(input, 6);
+    if (current == 0)
+        return 0;
 
-    processed = parse_ipv6address_ls32(&*current);
+    const size_type processed = record(instrument::ls32, parse_ipv6address_ls32(input.substr(current)));
     if (processed == 0)
         return 0;
-    current += processed;
-
-    return std::distance(input.begin(), current);
+    return current + processed;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_2(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_2(const string_view& input)
 {
     // See parse_ipv6address
     //
     // "::" 5( h16 ":" ) ls32
 
-    string_view::const_iterator current = input.begin();
-
-    if ((current == input.end()) || (*current != token_colon))
-        return 0;
-    ++current;
-    if ((current == input.end()) || (*current != token_colon))
-        return 0;
-    ++current;
-
-    size_type processed = 0;
-    for (size_type after = 0; after < 5; ++after)
-    {
-        processed = parse_ipv6address_h16(&*current);
-        if (processed == 0)
-            return 0;
-        current += processed;
-        if (current == input.end() || (*current != token_colon))
-            return 0;
-        ++current;
-        if (current == input.end())
-            return 0;
-    }
-
-    processed = parse_ipv6address_ls32(&*current);
-    if (processed == 0)
-        return 0;
-    current += processed;
-    
-    return std::distance(input.begin(), current);
+    return parse_ipv6address_3(input, 0, 5);
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_3(const string_view& input,
-                                                         size_type beforeLimit,
-                                                         size_type afterLimit)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_3(const string_view& input,
+                                           size_type beforeLimit,
+                                           size_type afterLimit)
 {
     // See parse_ipv6address
     //
@@ -433,165 +517,188 @@ inline uri_view::size_type uri_view::parse_ipv6address_3(const string_view& inpu
     // [ *1( h16 ":" ) h16 ] "::" 3( h16 ":" ) ls32
     // [ *2( h16 ":" ) h16 ] "::" 2( h16 ":" ) ls32
     // [ *3( h16 ":" ) h16 ] "::"    h16 ":"   ls32
+    // [ *4( h16 ":" ) h16 ] "::"              ls32
 
-    string_view::const_iterator current = input.begin();
-
-    size_type processed = 0;
-    for (size_type before = 0; before < beforeLimit; ++before)
-    {
-        processed = parse_ipv6address_h16(&*current);
-        current += processed;
-        if ((current == input.end()) || (*current != token_colon))
-            return 0;
-        ++current;
-        if (current == input.end())
-            return 0;
-        if (*current == token_colon)
-            break;
-    }
-    if (*current != token_colon)
+    size_type current = parse_ipv6address_compressed(input, beforeLimit);
+    if (current == 0)
         return 0;
-    ++current;
 
-    for (size_type after = 0; after < afterLimit; ++after)
+    size_type processed = 0;
+    if (afterLimit > 0)
     {
-        processed = parse_ipv6address_h16(&*current);
+        processed = parse_ipv6address_pieces(input.substr(current), afterLimit);
         if (processed == 0)
             return 0;
         current += processed;
-        if (current == input.end() || (*current != token_colon))
-            return 0;
-        ++current;
-        if (current == input.end())
-            return 0;
     }
 
-    processed = parse_ipv6address_ls32(&*current);
+    processed = record(instrument::ls32, parse_ipv6address_ls32(input.substr(current)));
     if (processed == 0)
         return 0;
-    current += processed;
-    
-    return std::distance(input.begin(), current);
+    return current + processed;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_4(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_4(const string_view& input)
 {
     // See parse_ipv6address
     //
     // [ *5( h16 ":" ) h16 ] "::"              h16
 
-    string_view::const_iterator current = input.begin();
-
-    size_type processed = 0;
-    for (size_type before = 0; before < 6; ++before)
-    {
-        processed = parse_ipv6address_h16(&*current);
-        current += processed;
-        if ((current == input.end()) || (*current != token_colon))
-            return 0;
-        ++current;
-        if (current == input.end())
-            return 0;
-        if (*current == token_colon)
-            break;
-    }
-    if (*current != token_colon)
+    const size_type current = parse_ipv6address_compressed(input, 6);
+    if (current == 0)
         return 0;
-    ++current;
 
-    processed = parse_ipv6address_h16(&*current);
+    const size_type processed = record(instrument::h16, parse_ipv6address_h16(input.substr(current)));
     if (processed == 0)
         return 0;
-    current += processed;
-    
-    return std::distance(input.begin(), current);
+    return current + processed;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_5(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_5(const string_view& input)
 {
     // See parse_ipv6address
     //
     // [ *6( h16 ":" ) h16 ] "::"
 
-    string_view::const_iterator current = input.begin();
+    return parse_ipv6address_compressed(input, 7);
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_compressed(const string_view& input,
+                                                    size_type limit)
+{
+    // See parse_ipv6address
+    //
+    // [ *(limit - 1)( h16 ":" ) h16 ] "::"
 
-    size_type processed = 0;
-    for (size_type before = 0; before < 7; ++before)
+    if ((input.size() >= 2) &&
+        (input[0] == token_colon) &&
+        (input[1] == token_colon))
+        return 2;
+
+    size_type current = 0;
+    for (size_type before = 0; before < limit; ++before)
     {
-        processed = parse_ipv6address_h16(&*current);
+        const size_type processed = record(instrument::h16, parse_ipv6address_h16(input.substr(current)));
+        if (processed == 0)
+            return 0;
         current += processed;
-        if ((current == input.end()) || (*current != token_colon))
+        if ((current >= input.size()) || (input[current] != token_colon))
             return 0;
         ++current;
-        if (current == input.end())
-            return 0;
-        if (*current == token_colon)
-            break;
+        if ((current < input.size()) && (input[current] == token_colon))
+            return current + 1;
     }
-    if (*current != token_colon)
-        return 0;
-    ++current;
+    return 0;
+}
 
-    return std::distance(input.begin(), current);
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_pieces(const string_view& input,
+                                                size_type count)
+{
+    // See parse_ipv6address
+    //
+    // count( h16 ":" )
+
+    size_type current = 0;
+    for (size_type after = 0; after < count; ++after)
+    {
+        const size_type processed = record(instrument::h16, parse_ipv6address_h16(input.substr(current)));
+        if (processed == 0)
+            return 0;
+        current += processed;
+        if ((current >= input.size()) || (input[current] != token_colon))
+            return 0;
+        ++current;
+    }
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_h16(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_h16(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // h16         = 1*4HEXDIG
     //             ; 16 bits of address represented in hexadecimal
 
-    if (input.size() < 4)
-        return 0;
-
-    if (!is_hexdig_token(input[0]))
-        return 0;
-    if (!is_hexdig_token(input[1]))
-        return 1;
-    if (!is_hexdig_token(input[2]))
-        return 2;
-    if (!is_hexdig_token(input[3]))
-        return 3;
-    return 4;
+    size_type current = 0;
+    while ((current < 4) &&
+           (current < input.size()) &&
+           is_hexdig_token(input[current]))
+    {
+        ++current;
+    }
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_ipv6address_ls32(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_ipv6address_ls32(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // ls32        = ( h16 ":" h16 ) / IPv4address
     //             ; least-significant 32 bits of address
 
-    string_view::const_iterator current = input.begin();
-    size_type processed = parse_ipv4address(&*current);
+    size_type processed = record(instrument::ipv4address, parse_ipv4address(input));
     if (processed > 0)
         return processed;
 
-    processed = parse_ipv6address_h16(&*current);
-    if (processed == 0)
+    size_type current = record(instrument::h16, parse_ipv6address_h16(input));
+    if (current == 0)
         return 0;
-    std::advance(current, processed);
-    if (*current != token_colon)
+    if ((current >= input.size()) || (input[current] != token_colon))
         return 0;
-    std::advance(current, 1);
-    processed = parse_ipv6address_h16(&*current);
+    ++current;
+    processed = record(instrument::h16, parse_ipv6address_h16(input.substr(current)));
     if (processed == 0)
         return 0;
-    std::advance(current, processed);
-    return std::distance(input.begin(), current);
+    return current + processed;
 }
 
-inline uri_view::size_type uri_view::parse_regname(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_regname(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
     // reg-name = *( unreserved / pct-encoded / sub-delims )
 
-    return 0; // FIXME
+    size_type current = 0;
+    while (current < input.size())
+    {
+        size_type processed = 0;
+        if (input[current] == token_percent)
+        {
+            processed = record(instrument::pct_encoded, parse_pct_encoded(input.substr(current)));
+            if (processed == 0)
+            {
+                reject(instrument::invalid_percent_encoding);
+            }
+        }
+        else if (is_unreserved_token(input[current]) ||
+                 is_subdelims_token(input[current]))
+        {
+            processed = 1;
+        }
+        if (processed == 0)
+            break;
+        current += processed;
+    }
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_dec_octet(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_dec_octet(string_view input)
 {
     // RFC 3986 Section 3.2.2
     //
@@ -600,38 +707,49 @@ inline uri_view::size_type uri_view::parse_dec_octet(string_view input)
     //             / "1" 2DIGIT            ; 100-199
     //             / "2" %x30-34 DIGIT     ; 200-249
     //             / "25" %x30-35          ; 250-255
+
+    const size_type size = input.size();
+    if (size == 0)
+        return 0;
+
     switch (input[0])
     {
     case 0x30:
         return 1;
 
     case 0x31:
-        if (!is_digit_token(input[1]))
+        if ((size < 2) || !is_digit_token(input[1]))
             return 1;
-        if (!is_digit_token(input[2]))
+        if ((size < 3) || !is_digit_token(input[2]))
             return 2;
         return 3;
 
     case 0x32:
+        if (size < 2)
+            return 1;
         switch (input[1])
         {
         case 0x30: case 0x31: case 0x32: case 0x33:
         case 0x34:
-            if (is_digit_token(input[2]))
+            if ((size > 2) && is_digit_token(input[2]))
                 return 3;
             return 2;
 
         case 0x35:
+            if (size < 3)
+                return 2;
             switch (input[2])
             {
             case 0x30: case 0x31: case 0x32: case 0x33:
             case 0x34: case 0x35:
                 return 3;
             default:
-                return 2; // FIXME
+                return 2;
             }
 
         default:
+            if (is_digit_token(input[1]))
+                return 2;
             return 1;
         }
 
@@ -642,7 +760,7 @@ inline uri_view::size_type uri_view::parse_dec_octet(string_view input)
     case 0x37:
     case 0x38:
     case 0x39:
-        if (is_digit_token(input[1]))
+        if ((size > 1) && is_digit_token(input[1]))
             return 2;
         return 1;
 
@@ -651,13 +769,15 @@ inline uri_view::size_type uri_view::parse_dec_octet(string_view input)
     }
 }
 
-inline uri_view::size_type uri_view::parse_port(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_port(string_view input)
 {
     // RFC 3986 Section 3.2.3
     //
     // port = *DIGIT
 
-    string_view::const_iterator current = input.begin();
+    typename string_view::const_iterator current = input.begin();
     while (current != input.end())
     {
         if (!is_digit_token(*current))
@@ -671,58 +791,90 @@ inline uri_view::size_type uri_view::parse_port(string_view input)
     return processed;
 }
 
-inline uri_view::size_type uri_view::parse_path_abempty(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_path_abempty(string_view input)
 {
     // RFC 3986 Section 3.3
     //
     // path-abempty  = *( "/" segment )
 
     size_type total = 0;
-    while (input[0] == token_slash)
+    while (!input.empty() && (input.front() == token_slash))
     {
-        size_type processed = sizeof(token_slash);
-        input.remove_prefix(processed);
-        total += processed;
-        processed = parse_segment(input);
-        if (processed == 0)
-            break;
+        input.remove_prefix(1);
+        total += 1;
+        // Segments may be empty
+        const size_type processed = record(instrument::segment, parse_segment(input));
         total += processed;
         input.remove_prefix(processed);
     }
     return total;
 }
 
-inline uri_view::size_type uri_view::parse_segment(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_path_absolute(const string_view& input)
+{
+    // RFC 3986 Section 3.3
+    //
+    // path-absolute = "/" [ segment-nz *( "/" segment ) ]
+
+    if (input.empty() || (input.front() != token_slash))
+        return 0;
+    return 1 + record(instrument::path_rootless, parse_path_rootless(input.substr(1)));
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_path_rootless(const string_view& input)
+{
+    // RFC 3986 Section 3.3
+    //
+    // path-rootless = segment-nz *( "/" segment )
+    // segment-nz    = 1*pchar
+
+    const size_type processed = record(instrument::segment, parse_segment(input));
+    if (processed == 0)
+        return 0;
+    return processed + record(instrument::path_abempty, parse_path_abempty(input.substr(processed)));
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_segment(string_view input)
 {
     // RFC 3986 Section 3.3
     //
     // segment = *pchar
 
-    string_view::const_iterator current = input.begin();
-    while (current != input.end())
+    size_type current = 0;
+    while (current < input.size())
     {
-        size_type processed = parse_pchar(&*current);
+        const size_type processed = record(instrument::pchar, parse_pchar(input.substr(current)));
         if (processed == 0)
             break;
-        std::advance(current, processed);
+        current += processed;
     }
-    return std::distance(input.begin(), current);
+    return current;
 }
 
-inline uri_view::size_type uri_view::parse_query(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_query(const string_view& input)
 {
     // RFC 3986 Section 3.4
     //
     // query = *( pchar / "/" / "?" )
 
-    string_view::const_iterator current = input.begin();
-    while (current != input.end())
+    size_type current = 0;
+    while (current < input.size())
     {
-        size_type processed = parse_pchar(&*current);
+        size_type processed = record(instrument::pchar, parse_pchar(input.substr(current)));
         if (processed == 0)
         {
-            if ((*current == token_slash) ||
-                (*current == token_question_mark))
+            if ((input[current] == token_slash) ||
+                (input[current] == token_question_mark))
             {
                 processed = 1;
             }
@@ -733,25 +885,27 @@ inline uri_view::size_type uri_view::parse_query(const string_view& input)
         }
         current += processed;
     }
-    const size_type result = std::distance(input.begin(), current);
+    const size_type result = current;
     query_view = input.substr(0, result);
     return result;
 }
 
-inline uri_view::size_type uri_view::parse_fragment(const string_view& input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_fragment(const string_view& input)
 {
     // RFC 3986 Section 3.5
     // 
     // fragment = *( pchar / "/" / "?" )
 
-    string_view::const_iterator current = input.begin();
-    while (current != input.end())
+    size_type current = 0;
+    while (current < input.size())
     {
-        size_type processed = parse_pchar(&*current);
+        size_type processed = record(instrument::pchar, parse_pchar(input.substr(current)));
         if (processed == 0)
         {
-            if ((*current == token_slash) ||
-                (*current == token_question_mark))
+            if ((input[current] == token_slash) ||
+                (input[current] == token_question_mark))
             {
                 processed = 1;
             }
@@ -762,21 +916,33 @@ inline uri_view::size_type uri_view::parse_fragment(const string_view& input)
         }
         current += processed;
     }
-    const size_type result = std::distance(input.begin(), current);
+    const size_type result = current;
     fragment_view = input.substr(0, result);
     return result;
 }
 
-inline uri_view::size_type uri_view::parse_pchar(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_pchar(string_view input)
 {
     // RFC 3986 Section 3.3
     //
     // pchar = unreserved / pct-encoded / sub-delims / ":" / "@"
 
+    if (input.empty())
+        return 0;
+
     switch (input[0])
     {
     case token_percent:
-        return parse_pct_encoded(input);
+        {
+            const size_type processed = record(instrument::pct_encoded, parse_pct_encoded(input));
+            if (processed == 0)
+            {
+                reject(instrument::invalid_percent_encoding);
+            }
+            return processed;
+        }
 
     case token_colon:
     case token_at:
@@ -789,141 +955,254 @@ inline uri_view::size_type uri_view::parse_pchar(string_view input)
     }
 }
 
-inline uri_view::size_type uri_view::parse_pct_encoded(string_view input)
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::parse_pct_encoded(string_view input)
 {
+    // RFC 3986 Section 2.1
+    //
     // pct-encoded = "%" HEXDIG HEXDIG
 
-    return 0; // FIXME
+    if (input.size() < 3)
+        return 0;
+    if (input[0] != token_percent)
+        return 0;
+    if (!is_hexdig_token(input[1]) || !is_hexdig_token(input[2]))
+        return 0;
+    return 3;
+}
+
+//-----------------------------------------------------------------------------
+// Instrumentation
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::size_type
+basic_uri_view<CharT, Instrument>::record(instrument::production which,
+                                          size_type processed)
+{
+    Instrument::count(which, processed);
+    return processed;
+}
+
+template <typename CharT, typename Instrument>
+void basic_uri_view<CharT, Instrument>::reject(instrument::rejection which)
+{
+    Instrument::reject(which);
 }
 
 //-----------------------------------------------------------------------------
 // Tokens
 //-----------------------------------------------------------------------------
 
-inline bool uri_view::is_alpha_token(value_type value) const
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_alpha_token(value_type value) const
 {
-    // RFC 2234 Section 6.1
-    //
-    // ALPHA = %x41-5A / %x61-7A  ; A-Z / a-z
-
-    switch (value)
-    {
-    case 0x41: case 0x42: case 0x43: // A-Z
-    case 0x44: case 0x45: case 0x46: case 0x47:
-    case 0x48: case 0x49: case 0x4A: case 0x4B:
-    case 0x4C: case 0x4D: case 0x4E: case 0x4F:
-    case 0x50: case 0x51: case 0x52: case 0x53:
-    case 0x54: case 0x55: case 0x56: case 0x57:
-    case 0x58: case 0x59: case 0x5A:
-    case 0x61: case 0x62: case 0x63: // a-z
-    case 0x64: case 0x65: case 0x66: case 0x67:
-    case 0x68: case 0x69: case 0x6A: case 0x6B:
-    case 0x6C: case 0x6D: case 0x6E: case 0x6F:
-    case 0x70: case 0x71: case 0x72: case 0x73:
-    case 0x74: case 0x75: case 0x76: case 0x77:
-    case 0x78: case 0x79: case 0x7A:
-        return true;
-    default:
-        return false;
-    }
+    return detail::traits<CharT>::is_alpha(value);
 }
 
-inline bool uri_view::is_digit_token(value_type value) const
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_digit_token(value_type value) const
 {
-    // RFC 2234 Section 6.1
-    //
-    // DIGIT =  %x30-39 ; 0-9
+    return detail::traits<CharT>::is_digit(value);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_hexdig_token(value_type value) const
+{
+    return detail::traits<CharT>::is_hexdigit(value);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_scheme_token(value_type value) const
+{
+    return detail::traits<CharT>::is_scheme(value);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_unreserved_token(value_type value) const
+{
+    return detail::traits<CharT>::is_unreserved(value);
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::is_subdelims_token(value_type value) const
+{
+    return detail::traits<CharT>::is_subdelims(value);
+}
+
+//-----------------------------------------------------------------------------
+// basic_uri_view::segment_iterator
+//-----------------------------------------------------------------------------
+
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::segment_iterator::segment_iterator()
+    : at_end(true)
+{
+}
+
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::segment_iterator::segment_iterator(const string_view& path)
+    : remaining(path),
+      at_end(path.empty())
+{
+    if (at_end)
+        return;
 
-    switch (value)
+    if (remaining.front() == token_slash)
     {
-    case 0x30: case 0x31: case 0x32: case 0x33:
-    case 0x34: case 0x35: case 0x36: case 0x37:
-    case 0x38: case 0x39:
-        return true;
-    default:
-        return false;
+        increment();
+    }
+    else
+    {
+        // path-rootless or path-noscheme starts without a slash
+        segment = front_segment(remaining);
+        remaining.remove_prefix(segment.size());
     }
 }
 
-inline bool uri_view::is_hexdig_token(value_type value) const
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::segment_iterator::reference
+basic_uri_view<CharT, Instrument>::segment_iterator::operator*() const
 {
-    // RFC 2234 Section 6.1
-    //
-    // HEXDIG =  DIGIT / "A" / "B" / "C" / "D" / "E" / "F"
-
-    switch (value)
-    {
-    case 0x30: case 0x31: case 0x32: case 0x33:
-    case 0x34: case 0x35: case 0x36: case 0x37:
-    case 0x38: case 0x39:
-    case 0x41: case 0x42: case 0x43: case 0x44: // A-F
-    case 0x45: case 0x46:
-    case 0x61: case 0x62: case 0x63: case 0x64: // a-f
-    case 0x65: case 0x66:
-        return true;
-    default:
-        return false;
-    }
+    return segment;
 }
-    
-inline bool uri_view::is_scheme_token(value_type value) const
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::segment_iterator::pointer
+basic_uri_view<CharT, Instrument>::segment_iterator::operator->() const
 {
-    // RFC 3986 Section 3.1
-    //
-    // Optional part of scheme.
-    //
-    // ALPHA / DIGIT / "+" / "-" / "."
+    return &segment;
+}
 
-    switch (value)
-    {
-    case token_plus:
-    case token_minus:
-    case token_dot:
-        return true;
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::segment_iterator&
+basic_uri_view<CharT, Instrument>::segment_iterator::operator++()
+{
+    increment();
+    return *this;
+}
 
-    default:
-        return (is_alpha_token(value) || is_digit_token(value));
-    }
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::segment_iterator
+basic_uri_view<CharT, Instrument>::segment_iterator::operator++(int)
+{
+    segment_iterator result = *this;
+    increment();
+    return result;
 }
 
-inline bool uri_view::is_unreserved_token(value_type value) const
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::segment_iterator::operator==(const segment_iterator& other) const
 {
-    // unreserved = ALPHA / DIGIT / "-" / "." / "_" / "~"
+    if (at_end || other.at_end)
+        return at_end == other.at_end;
+    return (remaining.data() == other.remaining.data());
+}
 
-    switch (value)
-    {
-    case token_minus:
-    case token_dot:
-    case token_underscore:
-    case token_tilde:
-        return true;
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::segment_iterator::operator!=(const segment_iterator& other) const
+{
+    return !(*this == other);
+}
 
-    default:
-        return (is_alpha_token(value) || is_digit_token(value));
+template <typename CharT, typename Instrument>
+void basic_uri_view<CharT, Instrument>::segment_iterator::increment()
+{
+    // The path has already been validated by parse_path_abempty, so only
+    // the segment delimiters need to be located.
+
+    if (remaining.empty())
+    {
+        at_end = true;
+        segment = string_view();
+        return;
     }
+    remaining.remove_prefix(1);
+    segment = front_segment(remaining);
+    remaining.remove_prefix(segment.size());
 }
 
-inline bool uri_view::is_subdelims_token(value_type value) const
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::string_view
+basic_uri_view<CharT, Instrument>::segment_iterator::front_segment(const string_view& input)
 {
-    // sub-delims = "!" / "$" / "&" / "'" / "(" / ")" / "*" / "+" / "," / ";" / "="
+    // char_traits::find is usually implemented with memchr
+    const CharT *found =
+        std::char_traits<CharT>::find(input.data(),
+                                      input.size(),
+                                      CharT(token_slash));
+    return input.substr(0, found ? size_type(found - input.data()) : input.size());
+}
 
-    switch (value)
-    {
-    case token_exclamation:
-    case token_dollar:
-    case token_at:
-    case token_apostrophe:
-    case token_parens_open:
-    case token_parens_close:
-    case token_asterisk:
-    case token_comma:
-    case token_semicolon:
-    case token_equal:
-        return true;
+//-----------------------------------------------------------------------------
+// basic_uri_view::query_iterator
+//-----------------------------------------------------------------------------
 
-    default:
-        return false;
-    }
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::query_iterator::query_iterator()
+    : form(string_view())
+{
+}
+
+template <typename CharT, typename Instrument>
+basic_uri_view<CharT, Instrument>::query_iterator::query_iterator(const string_view& query)
+    : form(query, basic_form_view<CharT, Instrument>::query_mode)
+{
+    update();
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::query_iterator::reference
+basic_uri_view<CharT, Instrument>::query_iterator::operator*() const
+{
+    return current;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::query_iterator::pointer
+basic_uri_view<CharT, Instrument>::query_iterator::operator->() const
+{
+    return &current;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::query_iterator&
+basic_uri_view<CharT, Instrument>::query_iterator::operator++()
+{
+    form.next();
+    update();
+    return *this;
+}
+
+template <typename CharT, typename Instrument>
+typename basic_uri_view<CharT, Instrument>::query_iterator
+basic_uri_view<CharT, Instrument>::query_iterator::operator++(int)
+{
+    query_iterator result = *this;
+    ++(*this);
+    return result;
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::query_iterator::operator==(const query_iterator& other) const
+{
+    // Keys are never empty, so an empty key denotes the end
+    return (current.first.data() == other.current.first.data()) &&
+        (current.first.size() == other.current.first.size());
+}
+
+template <typename CharT, typename Instrument>
+bool basic_uri_view<CharT, Instrument>::query_iterator::operator!=(const query_iterator& other) const
+{
+    return !(*this == other);
+}
+
+template <typename CharT, typename Instrument>
+void basic_uri_view<CharT, Instrument>::query_iterator::update()
+{
+    current.first = form.literal_key();
+    current.second = form.literal_value();
 }
 
 } // namespace network
@@ -12,43 +12,80 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <string>
-#include <boost/config.hpp>
-#include <boost/utility/string_ref.hpp>
+#include <network/config.hpp>
+#include <network/instrument.hpp>
+#include <network/detail/string_view.hpp>
 
 namespace network
 {
 
 // http://www.w3.org/TR/html401/interact/forms.html
 
-class form_view
+// Instrument is an instrumentation policy from network/instrument.hpp or
+// network/instrument_counters.hpp.
+
+template <typename CharT, typename Instrument = instrument::none>
+class basic_form_view
 {
 public:
-    typedef std::string string_type;
-    typedef boost::string_ref view_type;
-    typedef view_type::size_type size_type;
-    typedef view_type::value_type value_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef typename detail::basic_string_view<CharT>::type view_type;
+    typedef typename view_type::size_type size_type;
+    typedef typename view_type::value_type value_type;
+
+    // form_mode requires "key=value" pairs with non-empty keys and values,
+    // and stops at the first malformed pair.
+    //
+    // query_mode also accepts pairs without "=" and pairs with an empty
+    // value, in which case the value is empty. Pairs with an empty key are
+    // skipped. This mode is used by uri_view::query_params().
+    enum mode_type
+    {
+        form_mode,
+        query_mode
+    };
 
-    form_view(const view_type&);
+    basic_form_view(const view_type&, mode_type = form_mode);
 
-    bool next() BOOST_NOEXCEPT;
+    bool next() NETWORK_NOEXCEPT;
 
-    const view_type& literal_key() const BOOST_NOEXCEPT;
-    const view_type& literal_value() const BOOST_NOEXCEPT;
+    const view_type& literal_key() const NETWORK_NOEXCEPT;
+    const view_type& literal_value() const NETWORK_NOEXCEPT;
 
     string_type key() const;
+
+    // Decodes the value. String-like types throw std::runtime_error on
+    // incorrect percent encoding. Integer, floating-point, and bool types
+    // do not throw but return a value-initialized result on failure.
+    //
+    // Each percent-encoded octet is decoded into a single CharT.
     template <typename ReturnType> ReturnType value() const;
+    // Decodes the value. Returns false on failure.
+    template <typename ReturnType> bool value(ReturnType&) const;
 
 private:
+    bool next_form() NETWORK_NOEXCEPT;
+    bool next_query() NETWORK_NOEXCEPT;
     size_type parse_key(const view_type&);
     size_type parse_value(const view_type&);
+    size_type parse_query_value(const view_type&);
 
 private:
+    mode_type mode;
     view_type input_view;
     view_type key_view;
     view_type value_view;
     size_type count;
 };
 
+typedef basic_form_view<char> form_view;
+typedef basic_form_view<wchar_t> wform_view;
+typedef basic_form_view<char16_t> u16form_view;
+typedef basic_form_view<char32_t> u32form_view;
+#if defined(__cpp_char8_t)
+typedef basic_form_view<char8_t> u8form_view;
+#endif
+
 } // namespace network
 
 #include <network/detail/form_view.ipp>
@@ -0,0 +1,137 @@
+#ifndef NETWORK_IDNA_HPP
+#define NETWORK_IDNA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// RFC 3492
+//
+// Punycode conversion of a single label between code points and basic
+// (ASCII) code points. The "xn--" prefix is not included.
+
+class punycode
+{
+public:
+    typedef char value_type;
+    typedef char32_t code_point;
+
+    // Returns the end of the written characters, or null if the output is
+    // too small or the input contains invalid code points
+    static value_type *encode(const code_point *first,
+                              const code_point *last,
+                              value_type *output,
+                              value_type *output_last);
+
+    // Returns the end of the written code points, or null if the output is
+    // too small or the input is not valid Punycode
+    static code_point *decode(const value_type *first,
+                              const value_type *last,
+                              code_point *output,
+                              code_point *output_last);
+
+private:
+    enum
+    {
+        base = 36,
+        tmin = 1,
+        tmax = 26,
+        skew = 38,
+        damp = 700,
+        initial_bias = 72,
+        initial_n = 0x80,
+        delimiter = 0x2D // '-'
+    };
+
+    static std::uint32_t threshold(std::uint32_t k, std::uint32_t bias);
+    static std::uint32_t adapt(std::uint32_t delta, std::uint32_t count, bool first);
+    static value_type encode_digit(std::uint32_t);
+    // Returns base for invalid digits
+    static std::uint32_t decode_digit(value_type);
+};
+
+// RFC 3490
+//
+// Converts hosts, such as uri_view::host(), between internationalized and
+// ASCII-compatible encoding. Labels are separated by "." or by one of the
+// ideographic full stops U+3002, U+FF0E, and U+FF61.
+//
+// Both conversions accept hosts with UTF-8 directly or as percent-encoded
+// octets. ASCII letters are lowercased, but other characters are not
+// mapped with nameprep, so callers must pass hosts that are already
+// normalized. to_unicode() rejects "xn--" labels that do not encode back
+// into the same label.
+//
+// Hosts that are plain ASCII, which is_ascii() checks in a single pass, are
+// only lowercased into the buffer by to_ascii().
+//
+// The conversions return the end of the written characters, or null if the
+// host is malformed or the buffer is too small.
+
+class idna
+{
+public:
+    typedef uri_view::string_view string_view;
+    typedef string_view::size_type size_type;
+    typedef string_view::value_type value_type;
+
+    // True if the host has only ASCII characters and no percent-encoding
+    static bool is_ascii(const string_view& host);
+
+    static value_type *to_ascii(const string_view& host,
+                                value_type *buffer,
+                                size_type size);
+    static value_type *to_unicode(const string_view& host,
+                                  value_type *buffer,
+                                  size_type size);
+
+private:
+    typedef punycode::code_point code_point;
+
+    // RFC 3490 Section 5 limits labels to 63 characters
+    enum { label_limit = 63 };
+
+    typedef value_type *(*label_function)(const code_point *,
+                                          const code_point *,
+                                          value_type *,
+                                          value_type *);
+
+    static value_type *convert(const string_view& host,
+                               value_type *output,
+                               value_type *output_last,
+                               label_function);
+    static value_type *copy_lower(const string_view&, value_type *);
+    static value_type *encode_label(const code_point *first,
+                                    const code_point *last,
+                                    value_type *output,
+                                    value_type *output_last);
+    static value_type *decode_label(const code_point *first,
+                                    const code_point *last,
+                                    value_type *output,
+                                    value_type *output_last);
+
+    static bool is_separator(code_point);
+    static bool is_ace_prefix(const code_point *first, const code_point *last);
+    static bool next_octet(const string_view&, size_type& position, std::uint8_t& octet);
+    static bool next_code_point(const string_view&, size_type& position, code_point&);
+    static value_type *write_utf8(code_point, value_type *output, value_type *output_last);
+};
+
+} // namespace network
+
+#include <network/detail/idna.ipp>
+
+#endif // NETWORK_IDNA_HPP
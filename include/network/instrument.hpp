@@ -0,0 +1,97 @@
+#ifndef NETWORK_INSTRUMENT_HPP
+#define NETWORK_INSTRUMENT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <network/config.hpp>
+
+namespace network
+{
+
+// Instrumentation policies for basic_uri_view and basic_form_view.
+//
+// The policy is a template parameter, so the default instrument::none
+// compiles to nothing. instrument::counters, which keeps thread-local
+// counters, is declared in network/instrument_counters.hpp so that only
+// instrumented users include its synchronization headers.
+
+namespace instrument
+{
+
+enum production
+{
+    uri,
+    scheme,
+    hier_part,
+    authority,
+    userinfo,
+    host,
+    ip_literal,
+    ipv4address,
+    ipv6address,
+    ipv6address_1,
+    ipv6address_2,
+    ipv6address_3,
+    ipv6address_4,
+    ipv6address_5,
+    h16,
+    ls32,
+    reg_name,
+    dec_octet,
+    port,
+    path_abempty,
+    path_absolute,
+    path_rootless,
+    segment,
+    query,
+    fragment,
+    pchar,
+    pct_encoded,
+    form_key,
+    form_value,
+    form_decode,
+    production_count
+};
+
+enum rejection
+{
+    missing_scheme,
+    missing_colon,
+    invalid_authority,
+    invalid_ip_literal,
+    invalid_percent_encoding,
+    trailing_input,
+    form_missing_separator,
+    form_empty_key,
+    form_missing_equal,
+    form_empty_value,
+    form_invalid_value,
+    rejection_count
+};
+
+const char *name(production) NETWORK_NOEXCEPT;
+const char *name(rejection) NETWORK_NOEXCEPT;
+
+// No instrumentation
+
+struct none
+{
+    static void count(production, std::size_t) NETWORK_NOEXCEPT {}
+    static void reject(rejection) NETWORK_NOEXCEPT {}
+};
+
+} // namespace instrument
+} // namespace network
+
+#include <network/detail/instrument.ipp>
+
+#endif // NETWORK_INSTRUMENT_HPP
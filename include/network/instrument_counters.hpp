@@ -0,0 +1,102 @@
+#ifndef NETWORK_INSTRUMENT_COUNTERS_HPP
+#define NETWORK_INSTRUMENT_COUNTERS_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <network/config.hpp>
+#include <network/instrument.hpp>
+
+namespace network
+{
+
+// Instrumentation policy with thread-local counters per grammar production
+// and rejection reason, which are aggregated over all threads on demand.
+//
+// Users of this header must link with the threads library, for instance
+// with the network::uri_threads CMake target.
+
+namespace instrument
+{
+
+struct statistics
+{
+    statistics();
+
+    struct production_type
+    {
+        // Number of invocations
+        std::uint64_t calls;
+        // Number of invocations that did not match
+        std::uint64_t misses;
+        // Number of characters consumed by matches
+        std::uint64_t bytes;
+    };
+
+    production_type productions[production_count];
+    std::uint64_t rejections[rejection_count];
+};
+
+// Thread-local counters
+
+class counters
+{
+public:
+    static void count(production, std::size_t processed) NETWORK_NOEXCEPT;
+    static void reject(rejection) NETWORK_NOEXCEPT;
+
+    // Sum of the counters of all threads, including exited threads
+    static statistics collect();
+    // Zeroes the counters of all threads
+    static void reset();
+
+private:
+    typedef std::atomic<std::uint64_t> counter_type;
+
+    // Counters are only written by the owning thread, but may be read or
+    // reset concurrently, hence the relaxed atomics.
+    struct block
+    {
+        block();
+        ~block();
+
+        counter_type calls[production_count];
+        counter_type misses[production_count];
+        counter_type bytes[production_count];
+        counter_type rejections[rejection_count];
+        block *next;
+    };
+
+    // Blocks of live threads
+    struct registry
+    {
+        registry();
+
+        std::mutex mutex;
+        block *head;
+        statistics retired;
+    };
+
+    static block& local() NETWORK_NOEXCEPT;
+    static registry& global() NETWORK_NOEXCEPT;
+    static void increment(counter_type&, std::uint64_t) NETWORK_NOEXCEPT;
+    static void add(statistics&, const block&);
+};
+
+} // namespace instrument
+} // namespace network
+
+#include <network/detail/instrument_counters.ipp>
+
+#endif // NETWORK_INSTRUMENT_COUNTERS_HPP
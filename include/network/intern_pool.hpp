@@ -0,0 +1,118 @@
+#ifndef NETWORK_INTERN_POOL_HPP
+#define NETWORK_INTERN_POOL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// Thread-safe pool of case-insensitive URI components, such as schemes and
+// hosts, where each distinct component is stored once and identified by a
+// 32-bit identifier.
+//
+// Components are distributed over shards by hash. Each shard has its own
+// mutex for insertion and an open-addressing table that is searched without
+// locking. Tables replaced during growth are retired rather than deleted,
+// so concurrent readers never see freed memory.
+
+class intern_pool
+{
+public:
+    typedef uri_view::string_view string_view;
+    typedef string_view::size_type size_type;
+    typedef std::uint32_t id_type;
+
+    static const id_type npos = id_type(-1);
+
+    intern_pool();
+    ~intern_pool();
+
+    // Returns identifier of the ASCII case-folded text, adding it if absent.
+    // Throws std::length_error if the shard is full.
+    id_type insert(const string_view&);
+
+    // Returns identifier of the ASCII case-folded text or npos.
+    id_type find(const string_view&) const;
+
+    // Returns case-folded text of identifier returned by insert()
+    string_view at(id_type) const;
+
+    size_type size() const;
+
+private:
+    intern_pool(const intern_pool&);
+    intern_pool& operator=(const intern_pool&);
+
+    static const size_type shard_bits = 4;
+    static const size_type shard_count = size_type(1) << shard_bits;
+    static const size_type first_chunk_size = 64;
+    static const size_type max_chunks = 32 - shard_bits;
+    static const size_type initial_capacity = 16;
+
+    struct entry
+    {
+        entry(std::uint64_t, id_type, const string_view&);
+
+        std::uint64_t hash;
+        id_type id;
+        std::string text;
+    };
+
+    typedef std::atomic<const entry *> slot_type;
+
+    struct table
+    {
+        explicit table(size_type capacity);
+        ~table();
+
+        size_type mask;
+        slot_type *slots;
+    };
+
+    struct shard
+    {
+        shard();
+
+        std::mutex mutex;
+        std::atomic<table *> current;
+        std::atomic<size_type> count;
+        // Identifier lookup with chunks of doubling size
+        std::atomic<slot_type *> chunks[max_chunks];
+        // Protected by mutex
+        std::vector<table *> retired;
+    };
+
+    static std::uint64_t hash_folded(const string_view&);
+    static bool equal_folded(const std::string&, const string_view&);
+    static void locate(size_type index, size_type& chunk, size_type& offset);
+    static const entry *search(const table&, std::uint64_t, const string_view&);
+    static void place(table&, const entry *);
+
+    shard& shard_of(std::uint64_t hash);
+    const shard& shard_of(std::uint64_t hash) const;
+    void grow(shard&);
+
+private:
+    shard shards[shard_count];
+};
+
+} // namespace network
+
+#include <network/detail/intern_pool.ipp>
+
+#endif // NETWORK_INTERN_POOL_HPP
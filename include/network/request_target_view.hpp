@@ -0,0 +1,55 @@
+#ifndef NETWORK_REQUEST_TARGET_VIEW_HPP
+#define NETWORK_REQUEST_TARGET_VIEW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// RFC 7230 Section 5.3
+//
+// Parses the request-target of an HTTP/1.1 request-line. The component
+// accessors return views into the request-line buffer.
+
+class request_target_view : public uri_view
+{
+public:
+    enum form_type
+    {
+        no_form,
+        origin_form,
+        absolute_form,
+        authority_form,
+        asterisk_form
+    };
+
+    request_target_view(const string_view&);
+
+    form_type form() const;
+
+private:
+    void parse_target(const string_view&);
+    size_type parse_origin_form(const string_view&);
+    size_type parse_absolute_form(const string_view&);
+    size_type parse_authority_form(const string_view&);
+    void clear();
+
+private:
+    form_type target_form;
+};
+
+} // namespace network
+
+#include <network/detail/request_target_view.ipp>
+
+#endif // NETWORK_REQUEST_TARGET_VIEW_HPP
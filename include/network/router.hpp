@@ -0,0 +1,161 @@
+#ifndef NETWORK_ROUTER_HPP
+#define NETWORK_ROUTER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// Immutable path router.
+//
+// Route patterns are paths where a segment can be a literal, a ":name"
+// parameter that matches one non-empty segment, or a final "*name" wildcard
+// that matches the remainder of the path. Literal segments take precedence
+// over parameters, which take precedence over wildcards.
+//
+// Routes are collected by the builder and flattened into a segment trie
+// with one node per pattern segment, without path compression. Nodes are
+// stored in a single array, where the literal children of a node are
+// adjacent and sorted for binary search.
+//
+// Matching backtracks from the literal child to the parameter child and
+// then to the wildcard child. As every node has a single parent and sits
+// at a fixed depth, each node is visited at most once per match, so the
+// worst case is one binary search per node rather than exponential in the
+// path depth. Overlapping literal and parameter routes cost at most the
+// total number of pattern segments.
+//
+// Matching does not allocate. Parameters are views into the matched path.
+
+template <typename T>
+class router
+{
+public:
+    typedef T value_type;
+    typedef uri_view::string_view string_view;
+    typedef string_view::size_type size_type;
+    typedef std::pair<string_view, string_view> parameter_type;
+
+    static const size_type max_parameters = 8;
+
+    class builder;
+    class match_type;
+
+    explicit router(const builder&);
+
+    bool match(const string_view& path, match_type&) const;
+
+    size_type size() const;
+
+private:
+    typedef std::uint32_t index_type;
+    static const index_type npos = index_type(-1);
+
+    struct node
+    {
+        index_type label_offset;
+        index_type label_size;
+        index_type first_child;
+        index_type child_count;
+        index_type parameter_child;
+        index_type wildcard_child;
+        index_type value;
+    };
+
+    bool match_node(index_type,
+                    uri_view::segment_iterator,
+                    const string_view& path,
+                    match_type&) const;
+    index_type find_child(const node&, const string_view&) const;
+    int compare_label(const node&, const string_view&) const;
+    string_view label(const node&) const;
+    index_type append_label(const std::string&);
+
+private:
+    std::vector<node> nodes;
+    std::string labels;
+    std::vector<value_type> values;
+};
+
+template <typename T>
+class router<T>::builder
+{
+public:
+    builder();
+
+    // Throws std::invalid_argument for malformed or conflicting patterns
+    void insert(const string_view& pattern, const value_type& value);
+
+private:
+    friend class router<T>;
+
+    static const size_type npos = size_type(-1);
+
+    struct entry
+    {
+        entry();
+
+        std::string label;
+        std::vector<size_type> children;
+        size_type parameter_child;
+        size_type wildcard_child;
+        size_type value;
+    };
+
+    struct label_less
+    {
+        label_less(const std::vector<entry>&);
+        bool operator()(size_type, size_type) const;
+
+        const std::vector<entry>& entries;
+    };
+
+    size_type insert_child(size_type parent, const string_view& segment);
+
+private:
+    std::vector<entry> entries;
+    std::vector<value_type> values;
+};
+
+template <typename T>
+class router<T>::match_type
+{
+public:
+    match_type();
+
+    // Matched value or null
+    const value_type *value() const;
+
+    size_type size() const;
+    const parameter_type& operator[](size_type) const;
+
+    // Value of named parameter or empty view
+    string_view parameter(const string_view& name) const;
+
+private:
+    friend class router<T>;
+
+    const value_type *result;
+    size_type count;
+    parameter_type parameters[max_parameters];
+};
+
+} // namespace network
+
+#include <network/detail/router.ipp>
+
+#endif // NETWORK_ROUTER_HPP
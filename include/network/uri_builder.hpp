@@ -0,0 +1,99 @@
+#ifndef NETWORK_URI_BUILDER_HPP
+#define NETWORK_URI_BUILDER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// Serializes URI components into a caller-provided buffer.
+//
+// The builder only refers to the component views, so they must outlive it.
+// Characters that are not allowed in a component are percent-encoded, using
+// the same character classes as uri_view. Valid percent-encoded triplets
+// are kept as-is, so components from an existing uri_view are copied
+// unchanged.
+//
+// The authority is written if userinfo, host, or port is set, or if it was
+// enabled with authority(true). A path that does not start with "/" gets an
+// implicit "/" after an authority, and a path that starts with "//" gets a
+// "/." prefix without an authority.
+//
+// Without a scheme the output is a relative reference, which uri_view does
+// not parse.
+//
+// size() returns the exact length of the serialized URI, and write() then
+// fills a buffer of at least that size.
+
+class uri_builder
+{
+public:
+    typedef uri_view::string_view string_view;
+    typedef string_view::size_type size_type;
+    typedef string_view::value_type value_type;
+
+    uri_builder();
+    explicit uri_builder(const uri_view&);
+
+    // Throws std::invalid_argument if not a valid scheme
+    uri_builder& scheme(const string_view&);
+    // Writes "//" even if userinfo, host, and port are empty
+    uri_builder& authority(bool);
+    uri_builder& userinfo(const string_view&);
+    // Hosts containing ":" are written as IPv6 literals.
+    // Throws std::invalid_argument for invalid IPv6 literals.
+    uri_builder& host(const string_view&);
+    // Throws std::invalid_argument if not all digits
+    uri_builder& port(const string_view&);
+    uri_builder& path(const string_view&);
+    uri_builder& query(const string_view&);
+    uri_builder& fragment(const string_view&);
+
+    size_type size() const;
+    // Returns the end of the written characters
+    value_type *write(value_type *buffer) const;
+
+private:
+    typedef bool (*predicate_type)(value_type);
+
+    static size_type encoded_size(const string_view&, predicate_type);
+    static value_type *encode(const string_view&, predicate_type, value_type *);
+    static value_type *copy(const string_view&, value_type *);
+    static bool is_pct_encoded(const string_view&, size_type position);
+
+    static bool is_userinfo(value_type);
+    static bool is_regname(value_type);
+    static bool is_path(value_type);
+    static bool is_query(value_type);
+
+    bool has_authority() const;
+    bool is_ipv6_host() const;
+    bool needs_path_slash() const;
+    bool needs_path_dot() const;
+
+private:
+    string_view scheme_view;
+    string_view userinfo_view;
+    string_view host_view;
+    string_view port_view;
+    string_view path_view;
+    string_view query_view;
+    string_view fragment_view;
+    bool authority_enabled;
+};
+
+} // namespace network
+
+#include <network/detail/uri_builder.ipp>
+
+#endif // NETWORK_URI_BUILDER_HPP
@@ -0,0 +1,64 @@
+#ifndef NETWORK_URI_RECORD_HPP
+#define NETWORK_URI_RECORD_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <network/uri_view.hpp>
+#include <network/intern_pool.hpp>
+
+namespace network
+{
+
+// Compact representation of a parsed URI.
+//
+// The scheme and host are stored as intern_pool identifiers, so URIs with
+// the same scheme or host can be grouped by integer comparison. The path
+// and query are stored as offsets into a caller-owned buffer that contains
+// the URI.
+
+class uri_record
+{
+public:
+    typedef uri_view::string_view string_view;
+    typedef intern_pool::id_type id_type;
+    typedef std::uint32_t offset_type;
+
+    uri_record();
+    // The uri must be a view into buffer.
+    // Throws std::length_error if offsets exceed 32 bits.
+    uri_record(intern_pool&, const uri_view& uri, const string_view& buffer);
+
+    // Identifiers are intern_pool::npos for absent components
+    id_type scheme() const;
+    id_type host() const;
+
+    string_view path(const string_view& buffer) const;
+    string_view query(const string_view& buffer) const;
+
+private:
+    static offset_type offset_of(const string_view& component,
+                                 const string_view& buffer);
+
+private:
+    id_type scheme_id;
+    id_type host_id;
+    offset_type path_offset;
+    offset_type path_size;
+    offset_type query_offset;
+    offset_type query_size;
+};
+
+} // namespace network
+
+#include <network/detail/uri_record.ipp>
+
+#endif // NETWORK_URI_RECORD_HPP
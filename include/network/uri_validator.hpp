@@ -0,0 +1,102 @@
+#ifndef NETWORK_URI_VALIDATOR_HPP
+#define NETWORK_URI_VALIDATOR_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <network/uri_view.hpp>
+
+namespace network
+{
+
+// Validates many URIs in one call without constructing a uri_view for each.
+//
+// An input is valid if the whole input is an RFC 3986 URI, its scheme is one
+// of the allowed schemes, and its host is one of the allowed hosts. Schemes
+// and hosts are compared case-insensitively. If no schemes (or hosts) have
+// been allowed, then any scheme (or host) is accepted.
+//
+// The scheme is checked before the rest of the input is parsed, so inputs
+// with other schemes are rejected after a few characters.
+//
+// The batch validate() writes a bitmap where bit (i % 64) of word (i / 64)
+// is set if inputs[i] is valid. The bitmap must have bitmap_size(count)
+// words. If masks is non-null, then masks[i] is set to the non-empty
+// components of inputs[i], or zero if inputs[i] is not valid.
+
+template <typename CharT, typename Instrument = instrument::none>
+class basic_uri_validator : private basic_uri_view<CharT, Instrument>
+{
+    typedef basic_uri_view<CharT, Instrument> super;
+
+public:
+    typedef typename super::string_view string_view;
+    typedef typename super::size_type size_type;
+    typedef typename super::value_type value_type;
+    typedef std::uint64_t word_type;
+    typedef std::uint8_t mask_type;
+
+    enum
+    {
+        scheme_component = 1 << 0,
+        userinfo_component = 1 << 1,
+        host_component = 1 << 2,
+        port_component = 1 << 3,
+        authority_component = 1 << 4,
+        path_component = 1 << 5,
+        query_component = 1 << 6,
+        fragment_component = 1 << 7
+    };
+
+    basic_uri_validator();
+
+    void allow_scheme(const string_view&);
+    void allow_host(const string_view&);
+
+    bool validate(const string_view& input, mask_type *mask = 0);
+    // Returns the number of valid inputs
+    size_type validate(const string_view *inputs,
+                       size_type count,
+                       word_type *bitmap,
+                       mask_type *masks = 0);
+
+    // Number of bitmap words needed for count inputs
+    static size_type bitmap_size(size_type count);
+
+private:
+    typedef std::basic_string<CharT> string_type;
+
+    bool check(const string_view&);
+    void clear();
+    mask_type components() const;
+
+    bool is_allowed_scheme(const string_view&) const;
+    bool is_allowed_host(const string_view&) const;
+    static bool is_allowed(const std::vector<string_type>&, const string_view&);
+    static bool equal_lowered(const string_type& lowered, const string_view&);
+    static string_type to_lower(const string_view&);
+
+private:
+    std::vector<string_type> schemes;
+    std::vector<string_type> hosts;
+};
+
+typedef basic_uri_validator<char> uri_validator;
+typedef basic_uri_validator<wchar_t> wuri_validator;
+
+} // namespace network
+
+#include <network/detail/uri_validator.ipp>
+
+#endif // NETWORK_URI_VALIDATOR_HPP
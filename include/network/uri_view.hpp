@@ -11,31 +11,67 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <boost/utility/string_ref.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <network/form_view.hpp>
+#include <network/instrument.hpp>
+#include <network/detail/range.hpp>
+#include <network/detail/string_view.hpp>
+#include <network/detail/traits.hpp>
 
 namespace network
 {
 
-class uri_view
+// Input is a sequence of CharT code units whose values agree with ASCII in
+// the range 0x00-0x7F, such as UTF-8, UTF-16, or UTF-32. Percent-encoded
+// octets are not decoded by the view.
+//
+// Instrument is an instrumentation policy from network/instrument.hpp or
+// network/instrument_counters.hpp.
+
+template <typename CharT, typename Instrument = instrument::none>
+class basic_uri_view
 {
 public:
-    typedef boost::string_ref string_view;
-    typedef string_view::size_type size_type;
-    typedef string_view::value_type value_type;
+    typedef typename detail::basic_string_view<CharT>::type string_view;
+    typedef typename string_view::size_type size_type;
+    typedef typename string_view::value_type value_type;
 
-    uri_view(const string_view&);
+    class segment_iterator;
+    class query_iterator;
+    typedef detail::range<segment_iterator> segment_range;
+    typedef detail::range<query_iterator> query_range;
+
+    basic_uri_view(const string_view&);
 
     const string_view& scheme() const;
     const string_view& userinfo() const;
     const string_view& host() const;
     const string_view& port() const;
+    // Port as number, or zero if absent or out of range
+    std::uint16_t port_number() const;
+    // Port as number. Returns false if absent or out of range.
+    bool port_number(std::uint16_t&) const;
     const string_view& authority() const;
+    // True if the URI has an authority, even an empty one as in "file:///"
+    bool has_authority() const;
     const string_view& path() const;
     const string_view& query() const;
     const string_view& fragment() const;
 
-private:
-    void parse(string_view);
+    // Path segments without the "/" delimiters
+    segment_range path_segments() const;
+    // Key-value pairs of the query using the form_view tokenizer in
+    // query_mode, so keys without "=" yield an empty value
+    query_range query_params() const;
+
+protected:
+    basic_uri_view();
+
+    size_type parse(string_view);
     size_type parse_scheme(const string_view&);
     size_type parse_hier_part(const string_view&);
     size_type parse_authority(string_view);
@@ -49,18 +85,25 @@ private:
     size_type parse_ipv6address_3(const string_view&, size_type before, size_type after);
     size_type parse_ipv6address_4(const string_view&);
     size_type parse_ipv6address_5(const string_view&);
+    size_type parse_ipv6address_compressed(const string_view&, size_type limit);
+    size_type parse_ipv6address_pieces(const string_view&, size_type count);
     size_type parse_regname(string_view);
     size_type parse_dec_octet(string_view);
     size_type parse_ipv6address_h16(string_view);
     size_type parse_ipv6address_ls32(string_view);
     size_type parse_port(string_view);
     size_type parse_path_abempty(string_view);
+    size_type parse_path_absolute(const string_view&);
+    size_type parse_path_rootless(const string_view&);
     size_type parse_segment(string_view);
     size_type parse_query(const string_view&);
     size_type parse_fragment(const string_view&);
     size_type parse_pchar(string_view);
     size_type parse_pct_encoded(string_view);
 
+    static size_type record(instrument::production, size_type processed);
+    static void reject(instrument::rejection);
+
     bool is_alpha_token(value_type) const;
     bool is_digit_token(value_type) const;
     bool is_hexdig_token(value_type) const;
@@ -68,30 +111,30 @@ private:
     bool is_unreserved_token(value_type) const;
     bool is_subdelims_token(value_type) const;
 
-private:
-    static const value_type token_exclamation = '!';
-    static const value_type token_number_sign = '#';
-    static const value_type token_dollar = '$';
-    static const value_type token_percent = '%';
-    static const value_type token_ampersand = '&';
-    static const value_type token_apostrophe = '\'';
-    static const value_type token_parens_open = '(';
-    static const value_type token_parens_close = ')';
-    static const value_type token_asterisk = '*';
-    static const value_type token_plus = '+';
-    static const value_type token_comma = ',';
-    static const value_type token_minus = '-';
-    static const value_type token_dot = '.';
-    static const value_type token_slash = '/';
-    static const value_type token_colon = ':';
-    static const value_type token_semicolon = ';';
-    static const value_type token_equal = '=';
-    static const value_type token_question_mark = '?';
-    static const value_type token_at = '@';
-    static const value_type token_bracket_open = '[';
-    static const value_type token_bracket_close = ']';
-    static const value_type token_underscore = '_';
-    static const value_type token_tilde = '~';
+protected:
+    static const value_type token_exclamation = detail::traits<CharT>::alpha_exclamation;
+    static const value_type token_number_sign = detail::traits<CharT>::alpha_number_sign;
+    static const value_type token_dollar = detail::traits<CharT>::alpha_dollar;
+    static const value_type token_percent = detail::traits<CharT>::alpha_percent;
+    static const value_type token_ampersand = detail::traits<CharT>::alpha_ampersand;
+    static const value_type token_apostrophe = detail::traits<CharT>::alpha_apostrophe;
+    static const value_type token_parens_open = detail::traits<CharT>::alpha_parens_open;
+    static const value_type token_parens_close = detail::traits<CharT>::alpha_parens_close;
+    static const value_type token_asterisk = detail::traits<CharT>::alpha_asterisk;
+    static const value_type token_plus = detail::traits<CharT>::alpha_plus;
+    static const value_type token_comma = detail::traits<CharT>::alpha_comma;
+    static const value_type token_minus = detail::traits<CharT>::alpha_minus;
+    static const value_type token_dot = detail::traits<CharT>::alpha_dot;
+    static const value_type token_slash = detail::traits<CharT>::alpha_slash;
+    static const value_type token_colon = detail::traits<CharT>::alpha_colon;
+    static const value_type token_semicolon = detail::traits<CharT>::alpha_semicolon;
+    static const value_type token_equal = detail::traits<CharT>::alpha_equal;
+    static const value_type token_question_mark = detail::traits<CharT>::alpha_question_mark;
+    static const value_type token_at = detail::traits<CharT>::alpha_at;
+    static const value_type token_bracket_open = detail::traits<CharT>::alpha_bracket_open;
+    static const value_type token_bracket_close = detail::traits<CharT>::alpha_bracket_close;
+    static const value_type token_underscore = detail::traits<CharT>::alpha_underscore;
+    static const value_type token_tilde = detail::traits<CharT>::alpha_tilde;
 
     // Results
     string_view scheme_view;
@@ -104,6 +147,72 @@ private:
     string_view fragment_view;
 };
 
+template <typename CharT, typename Instrument>
+class basic_uri_view<CharT, Instrument>::segment_iterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename basic_uri_view<CharT, Instrument>::string_view value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type *pointer;
+    typedef const value_type& reference;
+
+    segment_iterator();
+    segment_iterator(const string_view& path);
+
+    reference operator*() const;
+    pointer operator->() const;
+    segment_iterator& operator++();
+    segment_iterator operator++(int);
+    bool operator==(const segment_iterator&) const;
+    bool operator!=(const segment_iterator&) const;
+
+private:
+    void increment();
+    static string_view front_segment(const string_view&);
+
+private:
+    string_view remaining;
+    string_view segment;
+    bool at_end;
+};
+
+template <typename CharT, typename Instrument>
+class basic_uri_view<CharT, Instrument>::query_iterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::pair<string_view, string_view> value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type *pointer;
+    typedef const value_type& reference;
+
+    query_iterator();
+    query_iterator(const string_view& query);
+
+    reference operator*() const;
+    pointer operator->() const;
+    query_iterator& operator++();
+    query_iterator operator++(int);
+    bool operator==(const query_iterator&) const;
+    bool operator!=(const query_iterator&) const;
+
+private:
+    void update();
+
+private:
+    basic_form_view<CharT, Instrument> form;
+    value_type current;
+};
+
+typedef basic_uri_view<char> uri_view;
+typedef basic_uri_view<wchar_t> wuri_view;
+typedef basic_uri_view<char16_t> u16uri_view;
+typedef basic_uri_view<char32_t> u32uri_view;
+#if defined(__cpp_char8_t)
+typedef basic_uri_view<char8_t> u8uri_view;
+#endif
+
 } // namespace network
 
 #include <network/detail/uri_view.ipp>
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <network/arena_uri.hpp>
+
+BOOST_AUTO_TEST_SUITE(arena_uri_suite)
+
+//-----------------------------------------------------------------------------
+// arena
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_arena_empty)
+{
+    network::arena storage;
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 0);
+    BOOST_REQUIRE_EQUAL(storage.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_arena_growth)
+{
+    network::arena storage(16, 64);
+    storage.allocate(10);
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 1);
+    storage.allocate(6);
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 1);
+    storage.allocate(1); // 32 byte block
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 2);
+    storage.allocate(100); // Oversized block
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 3);
+    BOOST_REQUIRE_EQUAL(storage.size(), 117);
+    storage.release();
+    BOOST_REQUIRE_EQUAL(storage.block_count(), 0);
+    BOOST_REQUIRE_EQUAL(storage.size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// arena_uri
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    network::arena_uri uri;
+    BOOST_REQUIRE_EQUAL(uri.text(), "");
+    BOOST_REQUIRE_EQUAL(uri.scheme(), "");
+    BOOST_REQUIRE_EQUAL(uri.path(), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_copy_input)
+{
+    network::arena storage;
+    std::string input("scheme://1.2.3.4:80/path?query#fragment");
+    network::arena_uri uri(storage, input);
+    input.assign(input.size(), 'x');
+    BOOST_REQUIRE_EQUAL(uri.text(), "scheme://1.2.3.4:80/path?query#fragment");
+    BOOST_REQUIRE_EQUAL(uri.scheme(), "scheme");
+    BOOST_REQUIRE_EQUAL(uri.host(), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(uri.port(), "80");
+    BOOST_REQUIRE_EQUAL(uri.authority(), "1.2.3.4:80");
+    BOOST_REQUIRE_EQUAL(uri.path(), "/path");
+    BOOST_REQUIRE_EQUAL(uri.query(), "query");
+    BOOST_REQUIRE_EQUAL(uri.fragment(), "fragment");
+}
+
+BOOST_AUTO_TEST_CASE(test_parsed)
+{
+    network::arena storage;
+    const char input[] = "scheme://1.2.3.4/path";
+    network::uri_view parsed(input);
+    network::arena_uri uri(storage, input, parsed);
+    BOOST_REQUIRE_EQUAL(uri.host(), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(uri.path(), "/path");
+    BOOST_REQUIRE(uri.path().data() != parsed.path().data());
+}
+
+BOOST_AUTO_TEST_CASE(test_clone)
+{
+    network::arena first;
+    network::arena second;
+    network::arena_uri original(first, "scheme://1.2.3.4/path");
+    network::arena_uri copy = original.clone(second);
+    first.release();
+    BOOST_REQUIRE_EQUAL(copy.text(), "scheme://1.2.3.4/path");
+    BOOST_REQUIRE_EQUAL(copy.host(), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(copy.path(), "/path");
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk)
+{
+    network::arena storage;
+    std::vector<network::arena_uri> uris;
+    for (int i = 0; i < 10000; ++i)
+    {
+        uris.push_back(network::arena_uri(storage, "scheme://1.2.3.4:80/alpha/bravo?charlie"));
+    }
+    BOOST_REQUIRE_LT(storage.block_count(), 10);
+    BOOST_REQUIRE_EQUAL(uris.back().query(), "charlie");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
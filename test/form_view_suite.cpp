@@ -8,6 +8,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <stdexcept>
+#include <string>
 #include <boost/test/unit_test.hpp>
 
 #include <network/form_view.hpp>
@@ -81,6 +83,118 @@ BOOST_AUTO_TEST_CASE(test_list_three)
     BOOST_REQUIRE_EQUAL(form.next(), false);
 }
 
+//-----------------------------------------------------------------------------
+// Numeric values
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_value_int)
+{
+    const char input[] = "alpha=42&bravo=-42&charlie=%2D7";
+    network::form_view form(input);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), 42);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), -42);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), -7);
+}
+
+BOOST_AUTO_TEST_CASE(test_value_int_limits)
+{
+    const char input[] = "alpha=-2147483648&bravo=2147483647&charlie=2147483648";
+    network::form_view form(input);
+    int result = 0;
+    BOOST_REQUIRE_EQUAL(form.value(result), true);
+    BOOST_REQUIRE_EQUAL(result, -2147483647 - 1);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), true);
+    BOOST_REQUIRE_EQUAL(result, 2147483647);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_value_unsigned)
+{
+    const char input[] = "alpha=255&bravo=256&charlie=-1";
+    network::form_view form(input);
+    unsigned char result = 0;
+    BOOST_REQUIRE_EQUAL(form.value(result), true);
+    BOOST_REQUIRE_EQUAL(result, 255);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+}
+
+BOOST_AUTO_TEST_CASE(fail_value_int)
+{
+    const char input[] = "alpha=4+2&bravo=42x&charlie=%4";
+    network::form_view form(input);
+    int result = 0;
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_value_double)
+{
+    const char input[] = "alpha=3.25&bravo=-1e3&charlie=1%2E5";
+    network::form_view form(input);
+    BOOST_REQUIRE_EQUAL(form.value<double>(), 3.25);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<double>(), -1000.0);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<float>(), 1.5f);
+}
+
+BOOST_AUTO_TEST_CASE(fail_value_double)
+{
+    const char input[] = "alpha=3.25x&bravo=1e999";
+    network::form_view form(input);
+    double result = 0.0;
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+}
+
+BOOST_AUTO_TEST_CASE(fail_value_float_range)
+{
+    const char input[] = "alpha=1e300&bravo=-1e300";
+    network::form_view form(input);
+    float result = 0.0f;
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_EQUAL(form.value<float>(), 0.0f);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_value_bool)
+{
+    const char input[] = "alpha=true&bravo=Off&charlie=1&delta=maybe";
+    network::form_view form(input);
+    bool result = false;
+    BOOST_REQUIRE_EQUAL(form.value(result), true);
+    BOOST_REQUIRE_EQUAL(result, true);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), true);
+    BOOST_REQUIRE_EQUAL(result, false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<bool>(), true);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+}
+
+BOOST_AUTO_TEST_CASE(fail_value_string)
+{
+    const char input[] = "alpha=%4";
+    network::form_view form(input);
+    std::string result;
+    BOOST_REQUIRE_EQUAL(form.value(result), false);
+    BOOST_REQUIRE_THROW(form.value<std::string>(), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(fail_ampersand)
 {
     const char input[] = "&";
@@ -95,4 +209,79 @@ BOOST_AUTO_TEST_CASE(fail_no_value)
     BOOST_REQUIRE_EQUAL(form.next(), false);
 }
 
+//-----------------------------------------------------------------------------
+// Query mode
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_query_key_only)
+{
+    const char input[] = "alpha&bravo=helium";
+    network::form_view form(input, network::form_view::query_mode);
+    BOOST_REQUIRE_EQUAL(form.literal_key(), "alpha");
+    BOOST_REQUIRE_EQUAL(form.literal_value(), "");
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.literal_key(), "bravo");
+    BOOST_REQUIRE_EQUAL(form.value<std::string>(), "helium");
+    BOOST_REQUIRE_EQUAL(form.next(), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_query_empty_value)
+{
+    const char input[] = "alpha=&bravo=2";
+    network::form_view form(input, network::form_view::query_mode);
+    BOOST_REQUIRE_EQUAL(form.literal_key(), "alpha");
+    BOOST_REQUIRE_EQUAL(form.value<std::string>(), "");
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.literal_key(), "bravo");
+    BOOST_REQUIRE_EQUAL(form.value<int>(), 2);
+    BOOST_REQUIRE_EQUAL(form.next(), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_query_empty_key)
+{
+    const char input[] = "&=hydrogen&&alpha";
+    network::form_view form(input, network::form_view::query_mode);
+    BOOST_REQUIRE_EQUAL(form.literal_key(), "alpha");
+    BOOST_REQUIRE_EQUAL(form.next(), false);
+}
+
+//-----------------------------------------------------------------------------
+// Character types
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_wchar)
+{
+    const wchar_t input[] = L"alpha=hydrogen+gas&bravo=-42&charlie=0.5&delta=On";
+    network::wform_view form(input);
+    BOOST_REQUIRE(form.key() == L"alpha");
+    BOOST_REQUIRE(form.value<std::wstring>() == L"hydrogen gas");
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), -42);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<double>(), 0.5);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    BOOST_REQUIRE_EQUAL(form.value<bool>(), true);
+    BOOST_REQUIRE_EQUAL(form.next(), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_char16)
+{
+    const char16_t input[] = u"alpha=%41%62";
+    network::u16form_view form(input);
+    BOOST_REQUIRE(form.literal_key() == u"alpha");
+    BOOST_REQUIRE(form.value<std::u16string>() == u"Ab");
+}
+
+BOOST_AUTO_TEST_CASE(fail_char16_non_ascii_number)
+{
+    // U+0661 is ARABIC-INDIC DIGIT ONE
+    const char16_t input[] = u"alpha=1\u0661&bravo=\u0661.5";
+    network::u16form_view form(input);
+    int number = 0;
+    BOOST_REQUIRE_EQUAL(form.value(number), false);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    double real = 0.0;
+    BOOST_REQUIRE_EQUAL(form.value(real), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
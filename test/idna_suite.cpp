@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <network/idna.hpp>
+
+using network::idna;
+using network::punycode;
+
+namespace
+{
+
+std::string encode(const std::u32string& input)
+{
+    char buffer[256];
+    const char *last = punycode::encode(input.data(),
+                                        input.data() + input.size(),
+                                        buffer,
+                                        buffer + sizeof(buffer));
+    return last ? std::string(buffer, last - buffer) : std::string("<null>");
+}
+
+std::u32string decode(const std::string& input)
+{
+    char32_t buffer[256];
+    const char32_t *last = punycode::decode(input.data(),
+                                            input.data() + input.size(),
+                                            buffer,
+                                            buffer + sizeof(buffer) / sizeof(buffer[0]));
+    return last ? std::u32string(buffer, last - buffer) : std::u32string(U"<null>");
+}
+
+std::string to_ascii(const idna::string_view& host)
+{
+    char buffer[256];
+    const char *last = idna::to_ascii(host, buffer, sizeof(buffer));
+    return last ? std::string(buffer, last - buffer) : std::string("<null>");
+}
+
+std::string to_unicode(const idna::string_view& host)
+{
+    char buffer[256];
+    const char *last = idna::to_unicode(host, buffer, sizeof(buffer));
+    return last ? std::string(buffer, last - buffer) : std::string("<null>");
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(idna_suite)
+
+//-----------------------------------------------------------------------------
+// Punycode
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_encode)
+{
+    BOOST_REQUIRE_EQUAL(encode(U""), "");
+    BOOST_REQUIRE_EQUAL(encode(U"abc"), "abc-");
+    BOOST_REQUIRE_EQUAL(encode(U"ü"), "tda");
+    BOOST_REQUIRE_EQUAL(encode(U"bücher"), "bcher-kva");
+    BOOST_REQUIRE_EQUAL(encode(U"münchen"), "mnchen-3ya");
+}
+
+BOOST_AUTO_TEST_CASE(test_encode_rfc3492)
+{
+    // RFC 3492 Section 7.1 (B) and (L)
+    BOOST_REQUIRE_EQUAL(encode(U"他们为什么不说中文"),
+                        "ihqwcrb4cv8a8dqg056pqjye");
+    BOOST_REQUIRE_EQUAL(encode(U"3年B組金八先生"),
+                        "3B-ww4c5e180e575a65lsy2b");
+}
+
+BOOST_AUTO_TEST_CASE(test_decode)
+{
+    BOOST_REQUIRE(decode("") == U"");
+    BOOST_REQUIRE(decode("tda") == U"ü");
+    BOOST_REQUIRE(decode("bcher-kva") == U"bücher");
+    BOOST_REQUIRE(decode("BCHER-KVA") == U"BüCHER");
+    BOOST_REQUIRE(decode("ihqwcrb4cv8a8dqg056pqjye") ==
+                  U"他们为什么不说中文");
+    BOOST_REQUIRE(decode("3B-ww4c5e180e575a65lsy2b") ==
+                  U"3年B組金八先生");
+}
+
+BOOST_AUTO_TEST_CASE(fail_decode)
+{
+    BOOST_REQUIRE(decode("bcher-kv!") == U"<null>");
+    BOOST_REQUIRE(decode("b\xC3\xBC" "cher-kva") == U"<null>");
+    BOOST_REQUIRE(decode("99999999999") == U"<null>");
+    BOOST_REQUIRE(decode("tdb") != U"<null>");
+    BOOST_REQUIRE(decode("td") == U"<null>");
+}
+
+BOOST_AUTO_TEST_CASE(fail_encode_small_buffer)
+{
+    const std::u32string input(U"bücher");
+    char buffer[8];
+    BOOST_REQUIRE(!punycode::encode(input.data(),
+                                    input.data() + input.size(),
+                                    buffer,
+                                    buffer + sizeof(buffer)));
+}
+
+//-----------------------------------------------------------------------------
+// ToASCII
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_is_ascii)
+{
+    BOOST_REQUIRE(idna::is_ascii(""));
+    BOOST_REQUIRE(idna::is_ascii("www.Example.com"));
+    BOOST_REQUIRE(!idna::is_ascii("b%C3%BCcher.example"));
+    BOOST_REQUIRE(!idna::is_ascii("b\xC3\xBC" "cher.example"));
+    // Beyond the first eight characters
+    BOOST_REQUIRE(!idna::is_ascii("www.example.com.%"));
+    BOOST_REQUIRE(!idna::is_ascii("www.exam%6Ce.com"));
+    BOOST_REQUIRE(!idna::is_ascii("www.example.com%41"));
+    BOOST_REQUIRE(!idna::is_ascii("www.example.co\xC3\xBC"));
+    BOOST_REQUIRE(!idna::is_ascii("www.example.c\x80om"));
+    BOOST_REQUIRE(idna::is_ascii("www.example.com$&"));
+}
+
+BOOST_AUTO_TEST_CASE(test_to_ascii_plain)
+{
+    BOOST_REQUIRE_EQUAL(to_ascii(""), "");
+    BOOST_REQUIRE_EQUAL(to_ascii("www.Example.COM"), "www.example.com");
+    BOOST_REQUIRE_EQUAL(to_ascii("XN--BCHER-KVA.example"), "xn--bcher-kva.example");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_ascii_utf8)
+{
+    BOOST_REQUIRE_EQUAL(to_ascii("b\xC3\xBC" "cher.example"), "xn--bcher-kva.example");
+    BOOST_REQUIRE_EQUAL(to_ascii("M\xC3\xBC" "nchen.DE"), "xn--mnchen-3ya.de");
+    // Ideographic full stop as separator
+    BOOST_REQUIRE_EQUAL(to_ascii("b\xC3\xBC" "cher\xE3\x80\x82" "example"), "xn--bcher-kva.example");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_ascii_pct_encoded)
+{
+    BOOST_REQUIRE_EQUAL(to_ascii("b%C3%BCcher.example"), "xn--bcher-kva.example");
+    BOOST_REQUIRE_EQUAL(to_ascii("%41bc"), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_ascii_uri_view)
+{
+    network::uri_view uri("http://B%C3%BCcher.example/path");
+    BOOST_REQUIRE_EQUAL(to_ascii(uri.host()), "xn--bcher-kva.example");
+}
+
+BOOST_AUTO_TEST_CASE(fail_to_ascii)
+{
+    // Invalid percent-encoding
+    BOOST_REQUIRE_EQUAL(to_ascii("b%C3%B"), "<null>");
+    // Truncated UTF-8
+    BOOST_REQUIRE_EQUAL(to_ascii("b\xC3"), "<null>");
+    // Overlong UTF-8
+    BOOST_REQUIRE_EQUAL(to_ascii("\xC0\xAF"), "<null>");
+    // Surrogate
+    BOOST_REQUIRE_EQUAL(to_ascii("\xED\xA0\x80"), "<null>");
+}
+
+BOOST_AUTO_TEST_CASE(fail_to_ascii_small_buffer)
+{
+    char buffer[8];
+    BOOST_REQUIRE(!idna::to_ascii("www.example.com", buffer, sizeof(buffer)));
+    BOOST_REQUIRE(!idna::to_ascii("b\xC3\xBC" "cher", buffer, sizeof(buffer)));
+    BOOST_REQUIRE(idna::to_ascii("\xC3\xBC", buffer, sizeof(buffer)) == buffer + 7);
+}
+
+BOOST_AUTO_TEST_CASE(fail_to_ascii_long_label)
+{
+    const std::string label(40, 'a');
+    BOOST_REQUIRE_EQUAL(to_ascii(label + "\xC3\xBC"), "xn--" + label + "-oge");
+    BOOST_REQUIRE_EQUAL(to_ascii(label + label + "\xC3\xBC"), "<null>");
+}
+
+//-----------------------------------------------------------------------------
+// ToUnicode
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_to_unicode)
+{
+    BOOST_REQUIRE_EQUAL(to_unicode(""), "");
+    BOOST_REQUIRE_EQUAL(to_unicode("www.Example.com"), "www.example.com");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kva.example"), "b\xC3\xBC" "cher.example");
+    BOOST_REQUIRE_EQUAL(to_unicode("XN--BCHER-KVA.example"), "b\xC3\xBC" "cher.example");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--r8jz45g.xn--zckzah"),
+                        "\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_unicode_percent_encoded)
+{
+    BOOST_REQUIRE_EQUAL(to_unicode("B%C3%BCcher.example"), "b\xC3\xBC" "cher.example");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kva.%65xample"), "b\xC3\xBC" "cher.example");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_unicode_separators)
+{
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kva\xE3\x80\x82" "example"), "b\xC3\xBC" "cher.example");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kva\xEF\xBC\x8E" "example"), "b\xC3\xBC" "cher.example");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kva\xEF\xBD\xA1" "example"), "b\xC3\xBC" "cher.example");
+}
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+    const std::string host = "\xE4\xBE\x8B\xE3\x81\x88.\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88";
+    BOOST_REQUIRE_EQUAL(to_ascii(host), "xn--r8jz45g.xn--zckzah");
+    BOOST_REQUIRE_EQUAL(to_unicode(to_ascii(host)), host);
+}
+
+BOOST_AUTO_TEST_CASE(fail_to_unicode)
+{
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--bcher-kv!.example"), "<null>");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--b%C3%BCcher.example"), "<null>");
+    BOOST_REQUIRE_EQUAL(to_unicode("b%C3.example"), "<null>");
+    // Does not encode back into the same label
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--abc-.example"), "<null>");
+    BOOST_REQUIRE_EQUAL(to_unicode("xn--.example"), "<null>");
+    char buffer[4];
+    BOOST_REQUIRE(!idna::to_unicode("xn--bcher-kva", buffer, sizeof(buffer)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+
+#include <network/instrument_counters.hpp>
+#include <network/uri_view.hpp>
+#include <network/form_view.hpp>
+
+namespace instrument = network::instrument;
+
+typedef network::basic_uri_view<char, instrument::counters> counted_uri_view;
+typedef network::basic_form_view<char, instrument::counters> counted_form_view;
+
+BOOST_AUTO_TEST_SUITE(instrument_suite)
+
+BOOST_AUTO_TEST_CASE(test_none_is_stateless)
+{
+    BOOST_REQUIRE_EQUAL(sizeof(counted_uri_view), sizeof(network::uri_view));
+    BOOST_REQUIRE_EQUAL(sizeof(counted_form_view), sizeof(network::form_view));
+}
+
+BOOST_AUTO_TEST_CASE(test_names)
+{
+    BOOST_REQUIRE_EQUAL(instrument::name(instrument::ipv6address_3), "IPv6address/3");
+    BOOST_REQUIRE_EQUAL(instrument::name(instrument::pct_encoded), "pct-encoded");
+    BOOST_REQUIRE_EQUAL(instrument::name(instrument::invalid_ip_literal), "invalid IP-literal");
+}
+
+BOOST_AUTO_TEST_CASE(test_productions)
+{
+    instrument::counters::reset();
+    const char input[] = "scheme://[::1]:80/path?alpha=%41";
+    counted_uri_view uri(input);
+    BOOST_REQUIRE_EQUAL(uri.host(), "::1");
+
+    const instrument::statistics result = instrument::counters::collect();
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::uri].calls, 1);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::uri].bytes, sizeof(input) - 1);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::scheme].bytes, 6);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::ip_literal].bytes, 5);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::ipv6address].calls, 1);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::ipv6address].bytes, 3);
+    BOOST_REQUIRE(result.productions[instrument::ipv6address_1].misses > 0);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::port].bytes, 2);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::query].bytes, 9);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::pct_encoded].calls, 1);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::pct_encoded].bytes, 3);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::fragment].calls, 0);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::trailing_input], 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_rejections)
+{
+    instrument::counters::reset();
+    counted_uri_view first("scheme");
+    counted_uri_view second("scheme://[::1/path");
+    counted_uri_view third("scheme://1.2.3.4/%4G");
+
+    const instrument::statistics result = instrument::counters::collect();
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::missing_colon], 1);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::invalid_ip_literal], 1);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::invalid_authority], 1);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::invalid_percent_encoding], 1);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::trailing_input], 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_form)
+{
+    instrument::counters::reset();
+    const char input[] = "alpha=1&bravo=x&=charlie";
+    counted_form_view form(input);
+    BOOST_REQUIRE_EQUAL(form.value<int>(), 1);
+    BOOST_REQUIRE_EQUAL(form.next(), true);
+    int number = 0;
+    BOOST_REQUIRE_EQUAL(form.value(number), false);
+    BOOST_REQUIRE_EQUAL(form.next(), false);
+
+    const instrument::statistics result = instrument::counters::collect();
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::form_key].calls, 3);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::form_key].misses, 1);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::form_key].bytes, 10);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::form_value].bytes, 2);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::form_decode].calls, 2);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::form_empty_key], 1);
+    BOOST_REQUIRE_EQUAL(result.rejections[instrument::form_invalid_value], 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_threads)
+{
+    instrument::counters::reset();
+    std::thread worker([] { counted_uri_view uri("scheme://1.2.3.4/path"); });
+    worker.join();
+    counted_uri_view uri("scheme://1.2.3.4/path");
+
+    // Counters of the exited thread are retained
+    const instrument::statistics result = instrument::counters::collect();
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::uri].calls, 2);
+    BOOST_REQUIRE_EQUAL(result.productions[instrument::ipv4address].calls, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <network/intern_pool.hpp>
+#include <network/uri_record.hpp>
+
+BOOST_AUTO_TEST_SUITE(intern_pool_suite)
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    network::intern_pool pool;
+    BOOST_REQUIRE_EQUAL(pool.size(), 0);
+    BOOST_REQUIRE(pool.find("alpha") == network::intern_pool::npos);
+}
+
+BOOST_AUTO_TEST_CASE(test_insert)
+{
+    network::intern_pool pool;
+    const network::intern_pool::id_type alpha = pool.insert("alpha");
+    const network::intern_pool::id_type bravo = pool.insert("bravo");
+    BOOST_REQUIRE_NE(alpha, bravo);
+    BOOST_REQUIRE_EQUAL(pool.size(), 2);
+    BOOST_REQUIRE_EQUAL(pool.insert("alpha"), alpha);
+    BOOST_REQUIRE_EQUAL(pool.find("alpha"), alpha);
+    BOOST_REQUIRE_EQUAL(pool.at(alpha), "alpha");
+    BOOST_REQUIRE_EQUAL(pool.at(bravo), "bravo");
+    BOOST_REQUIRE_EQUAL(pool.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_case_folding)
+{
+    network::intern_pool pool;
+    const network::intern_pool::id_type id = pool.insert("Example.COM");
+    BOOST_REQUIRE_EQUAL(pool.insert("example.com"), id);
+    BOOST_REQUIRE_EQUAL(pool.find("EXAMPLE.com"), id);
+    BOOST_REQUIRE_EQUAL(pool.at(id), "example.com");
+}
+
+BOOST_AUTO_TEST_CASE(test_grow)
+{
+    network::intern_pool pool;
+    std::vector<network::intern_pool::id_type> ids;
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::ostringstream host;
+        host << "host" << i << ".example";
+        ids.push_back(pool.insert(host.str()));
+    }
+    BOOST_REQUIRE_EQUAL(pool.size(), 10000);
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::ostringstream host;
+        host << "host" << i << ".example";
+        BOOST_REQUIRE_EQUAL(pool.find(host.str()), ids[i]);
+        BOOST_REQUIRE_EQUAL(pool.at(ids[i]), host.str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent)
+{
+    network::intern_pool pool;
+    const int thread_count = 4;
+    const int host_count = 2000;
+    std::vector<std::vector<network::intern_pool::id_type> > ids(thread_count);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.push_back(std::thread([&pool, &ids, t, host_count] {
+            for (int i = 0; i < host_count; ++i)
+            {
+                std::ostringstream host;
+                host << "host" << i << ".example";
+                ids[t].push_back(pool.insert(host.str()));
+            }
+        }));
+    }
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads[t].join();
+    }
+    BOOST_REQUIRE_EQUAL(pool.size(), host_count);
+    for (int t = 1; t < thread_count; ++t)
+    {
+        BOOST_REQUIRE(ids[t] == ids[0]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// uri_record
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_record)
+{
+    network::intern_pool pool;
+    const char buffer[] = "http://1.2.3.4/alpha?bravo HTTP://1.2.3.4/charlie";
+    const network::uri_view::string_view view(buffer);
+    network::uri_view first(view.substr(0, 26));
+    network::uri_view second(view.substr(27));
+
+    network::uri_record alpha(pool, first, view);
+    network::uri_record charlie(pool, second, view);
+    BOOST_REQUIRE_EQUAL(alpha.scheme(), charlie.scheme());
+    BOOST_REQUIRE_EQUAL(alpha.host(), charlie.host());
+    BOOST_REQUIRE_EQUAL(pool.at(alpha.scheme()), "http");
+    BOOST_REQUIRE_EQUAL(pool.at(alpha.host()), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(alpha.path(view), "/alpha");
+    BOOST_REQUIRE_EQUAL(alpha.query(view), "bravo");
+    BOOST_REQUIRE_EQUAL(charlie.path(view), "/charlie");
+    BOOST_REQUIRE_EQUAL(charlie.query(view), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_record_empty)
+{
+    network::uri_record record;
+    BOOST_REQUIRE(record.scheme() == network::intern_pool::npos);
+    BOOST_REQUIRE(record.host() == network::intern_pool::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
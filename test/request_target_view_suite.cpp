@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/unit_test.hpp>
+
+#include <network/request_target_view.hpp>
+
+BOOST_AUTO_TEST_SUITE(request_target_view_suite)
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    const char input[] = "";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+}
+
+//-----------------------------------------------------------------------------
+// Origin form
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_origin_root)
+{
+    const char input[] = "/";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "/");
+    BOOST_REQUIRE_EQUAL(target.query(), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_origin_path)
+{
+    const char input[] = "/alpha/bravo";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.authority(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "/alpha/bravo");
+    BOOST_REQUIRE_EQUAL(target.query(), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_origin_empty_segment)
+{
+    const char input[] = "/alpha//bravo/";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "/alpha//bravo/");
+}
+
+BOOST_AUTO_TEST_CASE(test_origin_path_query)
+{
+    const char input[] = "/path?alpha=hydrogen&bravo=helium";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "/path");
+    BOOST_REQUIRE_EQUAL(target.query(), "alpha=hydrogen&bravo=helium");
+}
+
+BOOST_AUTO_TEST_CASE(test_origin_percent)
+{
+    const char input[] = "/alpha%20bravo?q=%2F";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "/alpha%20bravo");
+    BOOST_REQUIRE_EQUAL(target.query(), "q=%2F");
+}
+
+BOOST_AUTO_TEST_CASE(test_origin_request_line)
+{
+    // Views must not extend beyond the given input
+    const char input[] = "GET /path?query HTTP/1.1";
+    network::request_target_view::string_view line(input);
+    network::request_target_view target(line.substr(4, 11));
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::origin_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "/path");
+    BOOST_REQUIRE_EQUAL(target.query(), "query");
+    BOOST_REQUIRE(target.path().data() == input + 4);
+}
+
+BOOST_AUTO_TEST_CASE(fail_origin_fragment)
+{
+    const char input[] = "/path#fragment";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+}
+
+BOOST_AUTO_TEST_CASE(fail_origin_bad_percent)
+{
+    const char input[] = "/path%2";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+}
+
+BOOST_AUTO_TEST_CASE(fail_origin_space)
+{
+    const char input[] = "/a b";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+    BOOST_REQUIRE_EQUAL(target.query(), "");
+}
+
+//-----------------------------------------------------------------------------
+// Absolute form
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_absolute)
+{
+    const char input[] = "http://1.2.3.4:80/path?query";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::absolute_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "http");
+    BOOST_REQUIRE_EQUAL(target.host(), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(target.port(), "80");
+    BOOST_REQUIRE_EQUAL(target.path(), "/path");
+    BOOST_REQUIRE_EQUAL(target.query(), "query");
+}
+
+BOOST_AUTO_TEST_CASE(test_absolute_rootless)
+{
+    const char input[] = "urn:a:b";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::absolute_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "urn");
+    BOOST_REQUIRE(!target.has_authority());
+    BOOST_REQUIRE_EQUAL(target.host(), "");
+    BOOST_REQUIRE_EQUAL(target.port(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "a:b");
+}
+
+BOOST_AUTO_TEST_CASE(test_absolute_path_absolute)
+{
+    const char input[] = "http:/x?query";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::absolute_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "http");
+    BOOST_REQUIRE_EQUAL(target.host(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "/x");
+    BOOST_REQUIRE_EQUAL(target.query(), "query");
+}
+
+BOOST_AUTO_TEST_CASE(fail_absolute_rootless_fragment)
+{
+    const char input[] = "urn:a#b";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+}
+
+BOOST_AUTO_TEST_CASE(fail_absolute_fragment)
+{
+    const char input[] = "http://1.2.3.4/path#fragment";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.host(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+    BOOST_REQUIRE_EQUAL(target.fragment(), "");
+}
+
+//-----------------------------------------------------------------------------
+// Authority form
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_authority)
+{
+    const char input[] = "1.2.3.4:443";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::authority_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.host(), "1.2.3.4");
+    BOOST_REQUIRE_EQUAL(target.port(), "443");
+    BOOST_REQUIRE_EQUAL(target.authority(), "1.2.3.4:443");
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_authority_ipv6)
+{
+    const char input[] = "[::1111:2222:3333:4444:5555:6666]:443";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::authority_form);
+    BOOST_REQUIRE_EQUAL(target.host(), "::1111:2222:3333:4444:5555:6666");
+    BOOST_REQUIRE_EQUAL(target.port(), "443");
+}
+
+BOOST_AUTO_TEST_CASE(test_authority_regname)
+{
+    const char input[] = "www.example.com:443";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::authority_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.host(), "www.example.com");
+    BOOST_REQUIRE_EQUAL(target.port(), "443");
+}
+
+BOOST_AUTO_TEST_CASE(fail_authority_no_host)
+{
+    const char input[] = ":443";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+}
+
+BOOST_AUTO_TEST_CASE(fail_authority_no_port)
+{
+    const char input[] = "1.2.3.4";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+    BOOST_REQUIRE_EQUAL(target.host(), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_authority_scheme_like)
+{
+    const char input[] = "localhost:80";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::authority_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.host(), "localhost");
+    BOOST_REQUIRE_EQUAL(target.port(), "80");
+}
+
+BOOST_AUTO_TEST_CASE(fail_authority_bad_port)
+{
+    const char input[] = "1.2.3.4:a";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+    BOOST_REQUIRE_EQUAL(target.scheme(), "");
+    BOOST_REQUIRE_EQUAL(target.host(), "");
+    BOOST_REQUIRE_EQUAL(target.port(), "");
+    BOOST_REQUIRE_EQUAL(target.authority(), "");
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+}
+
+//-----------------------------------------------------------------------------
+// Asterisk form
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_asterisk)
+{
+    const char input[] = "*";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::asterisk_form);
+    BOOST_REQUIRE_EQUAL(target.path(), "");
+}
+
+BOOST_AUTO_TEST_CASE(fail_asterisk_trailing)
+{
+    const char input[] = "*/";
+    network::request_target_view target(input);
+    BOOST_REQUIRE_EQUAL(target.form(), network::request_target_view::no_form);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdexcept>
+#include <string>
+#include <boost/test/unit_test.hpp>
+
+#include <network/router.hpp>
+
+typedef network::router<int> router_type;
+
+BOOST_AUTO_TEST_SUITE(router_suite)
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    router_type::builder builder;
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.size(), 0);
+    BOOST_REQUIRE_EQUAL(router.match("/", match), false);
+    BOOST_REQUIRE(match.value() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_root)
+{
+    router_type::builder builder;
+    builder.insert("/", 1);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 1);
+    BOOST_REQUIRE_EQUAL(router.match("/alpha", match), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_literal)
+{
+    router_type::builder builder;
+    builder.insert("/alpha", 1);
+    builder.insert("/alpha/bravo", 2);
+    builder.insert("/charlie", 3);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/alpha", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 1);
+    BOOST_REQUIRE_EQUAL(match.size(), 0);
+    BOOST_REQUIRE_EQUAL(router.match("/alpha/bravo", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 2);
+    BOOST_REQUIRE_EQUAL(router.match("/charlie", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 3);
+    BOOST_REQUIRE_EQUAL(router.match("/bravo", match), false);
+    BOOST_REQUIRE_EQUAL(router.match("/alpha/", match), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_parameter)
+{
+    router_type::builder builder;
+    builder.insert("/users/:id/posts/:post", 1);
+    router_type router(builder);
+    router_type::match_type match;
+    const char input[] = "/users/42/posts/7";
+    BOOST_REQUIRE_EQUAL(router.match(input, match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 1);
+    BOOST_REQUIRE_EQUAL(match.size(), 2);
+    BOOST_REQUIRE_EQUAL(match[0].first, "id");
+    BOOST_REQUIRE_EQUAL(match[0].second, "42");
+    BOOST_REQUIRE(match[0].second.data() == input + 7);
+    BOOST_REQUIRE_EQUAL(match.parameter("post"), "7");
+    BOOST_REQUIRE_EQUAL(match.parameter("unknown"), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_parameter_empty_segment)
+{
+    router_type::builder builder;
+    builder.insert("/users/:id", 1);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/users/", match), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_wildcard)
+{
+    router_type::builder builder;
+    builder.insert("/static/*file", 1);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/static/css/main.css", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 1);
+    BOOST_REQUIRE_EQUAL(match.parameter("file"), "css/main.css");
+    BOOST_REQUIRE_EQUAL(router.match("/static", match), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_precedence)
+{
+    router_type::builder builder;
+    builder.insert("/users/me", 1);
+    builder.insert("/users/:id", 2);
+    builder.insert("/users/*rest", 3);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/users/me", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 1);
+    BOOST_REQUIRE_EQUAL(router.match("/users/42", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 2);
+    BOOST_REQUIRE_EQUAL(router.match("/users/42/posts", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 3);
+    BOOST_REQUIRE_EQUAL(match.parameter("rest"), "42/posts");
+}
+
+BOOST_AUTO_TEST_CASE(test_backtrack)
+{
+    router_type::builder builder;
+    builder.insert("/alpha/bravo/charlie", 1);
+    builder.insert("/alpha/:name/delta", 2);
+    router_type router(builder);
+    router_type::match_type match;
+    BOOST_REQUIRE_EQUAL(router.match("/alpha/bravo/delta", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 2);
+    BOOST_REQUIRE_EQUAL(match.size(), 1);
+    BOOST_REQUIRE_EQUAL(match.parameter("name"), "bravo");
+}
+
+BOOST_AUTO_TEST_CASE(test_backtrack_adversarial)
+{
+    // Every combination of literal and parameter segments, so a path that
+    // only fails at the last segment visits the whole trie
+    const int depth = router_type::max_parameters;
+    router_type::builder builder;
+    for (int mask = 0; mask < (1 << depth); ++mask)
+    {
+        std::string pattern;
+        for (int level = 0; level < depth; ++level)
+        {
+            if (mask & (1 << level))
+                pattern += "/:p" + std::to_string(level);
+            else
+                pattern += "/a";
+        }
+        builder.insert(pattern + "/end", mask);
+    }
+    router_type router(builder);
+    router_type::match_type match;
+
+    std::string literal_path;
+    std::string parameter_path;
+    for (int level = 0; level < depth; ++level)
+    {
+        literal_path += "/a";
+        parameter_path += "/b";
+    }
+    BOOST_REQUIRE_EQUAL(router.match(literal_path + "/end", match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 0);
+    BOOST_REQUIRE_EQUAL(match.size(), 0);
+    // Parameters are views into the path
+    parameter_path += "/end";
+    BOOST_REQUIRE_EQUAL(router.match(parameter_path, match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), (1 << depth) - 1);
+    BOOST_REQUIRE_EQUAL(match.size(), depth);
+    BOOST_REQUIRE_EQUAL(match.parameter("p0"), "b");
+    BOOST_REQUIRE_EQUAL(router.match(literal_path + "/miss", match), false);
+    BOOST_REQUIRE_EQUAL(match.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_backtrack_deep)
+{
+    // Literal and parameter branches at the top of a deep path
+    std::string literal_path;
+    for (int level = 0; level < 1000; ++level)
+    {
+        literal_path += "/a";
+    }
+    router_type::builder builder;
+    builder.insert(literal_path + "/x", 1);
+    builder.insert("/:p" + literal_path.substr(2) + "/y", 2);
+    router_type router(builder);
+    router_type::match_type match;
+    const std::string path = literal_path + "/y";
+    BOOST_REQUIRE_EQUAL(router.match(path, match), true);
+    BOOST_REQUIRE_EQUAL(*match.value(), 2);
+    BOOST_REQUIRE_EQUAL(match.parameter("p"), "a");
+    BOOST_REQUIRE_EQUAL(router.match(literal_path + "/z", match), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_uri_path)
+{
+    router_type::builder builder;
+    builder.insert("/users/:id", 1);
+    router_type router(builder);
+    router_type::match_type match;
+    const char input[] = "http://1.2.3.4/users/42?verbose=true";
+    network::uri_view uri(input);
+    BOOST_REQUIRE_EQUAL(router.match(uri.path(), match), true);
+    BOOST_REQUIRE_EQUAL(match.parameter("id"), "42");
+}
+
+BOOST_AUTO_TEST_CASE(fail_relative)
+{
+    router_type::builder builder;
+    BOOST_REQUIRE_THROW(builder.insert("alpha", 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fail_duplicate)
+{
+    router_type::builder builder;
+    builder.insert("/alpha", 1);
+    BOOST_REQUIRE_THROW(builder.insert("/alpha", 2), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fail_conflicting_parameter)
+{
+    router_type::builder builder;
+    builder.insert("/users/:id", 1);
+    BOOST_REQUIRE_THROW(builder.insert("/users/:name/posts", 2), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fail_wildcard_not_last)
+{
+    router_type::builder builder;
+    BOOST_REQUIRE_THROW(builder.insert("/static/*file/alpha", 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fail_unnamed_parameter)
+{
+    router_type::builder builder;
+    BOOST_REQUIRE_THROW(builder.insert("/users/:", 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
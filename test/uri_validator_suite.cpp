@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2015 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include <network/uri_validator.hpp>
+
+using network::uri_validator;
+
+BOOST_AUTO_TEST_SUITE(uri_validator_suite)
+
+//-----------------------------------------------------------------------------
+// Single input
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+    uri_validator validator;
+    BOOST_REQUIRE(!validator.validate(""));
+}
+
+BOOST_AUTO_TEST_CASE(test_empty_with_scheme)
+{
+    uri_validator validator;
+    validator.allow_scheme("http");
+    BOOST_REQUIRE(!validator.validate(""));
+}
+
+BOOST_AUTO_TEST_CASE(test_any)
+{
+    uri_validator validator;
+    BOOST_REQUIRE(validator.validate("http://127.0.0.1/path"));
+    BOOST_REQUIRE(validator.validate("urn:isbn"));
+    BOOST_REQUIRE(!validator.validate("http://127.0.0.1/ path"));
+    BOOST_REQUIRE(!validator.validate("/path"));
+}
+
+BOOST_AUTO_TEST_CASE(test_scheme)
+{
+    uri_validator validator;
+    validator.allow_scheme("http");
+    validator.allow_scheme("HTTPS");
+    BOOST_REQUIRE(validator.validate("http://127.0.0.1"));
+    BOOST_REQUIRE(validator.validate("https://127.0.0.1"));
+    BOOST_REQUIRE(validator.validate("HTTPS://127.0.0.1"));
+    BOOST_REQUIRE(!validator.validate("ftp://127.0.0.1"));
+    BOOST_REQUIRE(!validator.validate("httpx://127.0.0.1"));
+    BOOST_REQUIRE(!validator.validate("http"));
+    BOOST_REQUIRE(!validator.validate("http:/%"));
+}
+
+BOOST_AUTO_TEST_CASE(test_host)
+{
+    uri_validator validator;
+    validator.allow_host("127.0.0.1");
+    validator.allow_host("::1");
+    validator.allow_host("example.com");
+    BOOST_REQUIRE(validator.validate("http://127.0.0.1/"));
+    BOOST_REQUIRE(validator.validate("http://Example.COM/"));
+    BOOST_REQUIRE(!validator.validate("http://www.example.com/"));
+    BOOST_REQUIRE(validator.validate("http://[::1]:80/"));
+    BOOST_REQUIRE(!validator.validate("http://127.0.0.2/"));
+    BOOST_REQUIRE(!validator.validate("urn:isbn"));
+}
+
+BOOST_AUTO_TEST_CASE(test_reuse)
+{
+    uri_validator validator;
+    uri_validator::mask_type mask = 0;
+    BOOST_REQUIRE(validator.validate("http://127.0.0.1:80/path?query#fragment", &mask));
+    BOOST_REQUIRE_EQUAL(mask, 0xFF & ~uri_validator::userinfo_component);
+    BOOST_REQUIRE(validator.validate("urn:isbn", &mask));
+    BOOST_REQUIRE_EQUAL(mask, uri_validator::scheme_component | uri_validator::path_component);
+    BOOST_REQUIRE(!validator.validate("urn:is bn", &mask));
+    BOOST_REQUIRE_EQUAL(mask, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_wide)
+{
+    network::wuri_validator validator;
+    validator.allow_scheme(L"https");
+    BOOST_REQUIRE(validator.validate(L"https://127.0.0.1/"));
+    BOOST_REQUIRE(!validator.validate(L"http://127.0.0.1/"));
+}
+
+//-----------------------------------------------------------------------------
+// Batch
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_batch_empty)
+{
+    uri_validator validator;
+    BOOST_REQUIRE_EQUAL(uri_validator::bitmap_size(0), 0);
+    BOOST_REQUIRE_EQUAL(validator.validate(0, 0, 0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch)
+{
+    uri_validator validator;
+    validator.allow_scheme("http");
+    validator.allow_scheme("https");
+    validator.allow_host("127.0.0.1");
+    const uri_validator::string_view inputs[] =
+    {
+        "http://127.0.0.1/",
+        "ftp://127.0.0.1/",
+        "https://127.0.0.1/path?query",
+        "https://127.0.0.2/",
+        "https://127.0.0.1/ "
+    };
+    const uri_validator::size_type count = sizeof(inputs) / sizeof(inputs[0]);
+    uri_validator::word_type bitmap[1] = { ~uri_validator::word_type(0) };
+    uri_validator::mask_type masks[count];
+    BOOST_REQUIRE_EQUAL(validator.validate(inputs, count, bitmap, masks), 2);
+    BOOST_REQUIRE_EQUAL(bitmap[0], 0x05U);
+    BOOST_REQUIRE_EQUAL(masks[0],
+                        uri_validator::scheme_component |
+                        uri_validator::host_component |
+                        uri_validator::authority_component |
+                        uri_validator::path_component);
+    BOOST_REQUIRE_EQUAL(masks[1], 0);
+    BOOST_REQUIRE_EQUAL(masks[2],
+                        uri_validator::scheme_component |
+                        uri_validator::host_component |
+                        uri_validator::authority_component |
+                        uri_validator::path_component |
+                        uri_validator::query_component);
+    BOOST_REQUIRE_EQUAL(masks[3], 0);
+    BOOST_REQUIRE_EQUAL(masks[4], 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_empty_element)
+{
+    uri_validator validator;
+    validator.allow_scheme("http");
+    const uri_validator::string_view inputs[] =
+    {
+        "http://a",
+        "",
+        "ftp://b"
+    };
+    uri_validator::word_type bitmap[1] = { 0 };
+    uri_validator::mask_type masks[3];
+    BOOST_REQUIRE_EQUAL(validator.validate(inputs, 3, bitmap, masks), 1);
+    BOOST_REQUIRE_EQUAL(bitmap[0], 0x01U);
+    BOOST_REQUIRE_EQUAL(masks[1], 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_words)
+{
+    uri_validator validator;
+    std::vector<uri_validator::string_view> inputs;
+    for (int i = 0; i < 130; ++i)
+    {
+        inputs.push_back((i % 3 == 0) ? "http://127.0.0.1" : "http://127.0.0.1 ");
+    }
+    BOOST_REQUIRE_EQUAL(uri_validator::bitmap_size(inputs.size()), 3);
+    std::vector<uri_validator::word_type> bitmap(3);
+    BOOST_REQUIRE_EQUAL(validator.validate(inputs.data(), inputs.size(), bitmap.data()), 44);
+    for (int i = 0; i < 130; ++i)
+    {
+        const bool bit = (bitmap[i / 64] >> (i % 64)) & 1;
+        BOOST_REQUIRE_EQUAL(bit, (i % 3 == 0));
+    }
+    BOOST_REQUIRE_EQUAL(bitmap[2] >> 2, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()